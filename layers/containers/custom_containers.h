@@ -24,6 +24,7 @@
 #include <limits>
 #include <memory>
 #include <map>
+#include <new>
 #include <unordered_map>
 #include <set>
 #include <algorithm>
@@ -31,6 +32,7 @@
 #include <type_traits>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #ifdef USE_ROBIN_HOOD_HASHING
 #include "robin_hood.h"
@@ -494,6 +496,191 @@ class small_vector {
     }
 };
 
+// Vector stored as a list of fixed size chunks.
+// Appending never moves or copies the elements already stored, and allocates only once every kChunkSize elements, which
+// makes it a good fit for large append-only logs. The price is one extra indirection on element access.
+template <typename T, size_t kChunkSize = 256>
+class chunked_vector {
+    static_assert(kChunkSize > 0 && (kChunkSize & (kChunkSize - 1)) == 0, "kChunkSize must be a power of two");
+
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+
+    template <typename Container, typename Value>
+    class IteratorImpl {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename chunked_vector::value_type;
+        using difference_type = typename chunked_vector::difference_type;
+        using pointer = Value *;
+        using reference = Value &;
+
+        IteratorImpl() = default;
+        IteratorImpl(Container *container, size_type index) : container_(container), index_(index) {}
+        // Allow iterator to const_iterator conversion
+        template <typename OtherContainer, typename OtherValue>
+        IteratorImpl(const IteratorImpl<OtherContainer, OtherValue> &other) : container_(other.container_), index_(other.index_) {}
+
+        reference operator*() const { return (*container_)[index_]; }
+        pointer operator->() const { return &(*container_)[index_]; }
+        reference operator[](difference_type offset) const { return (*container_)[index_ + offset]; }
+
+        IteratorImpl &operator++() {
+            ++index_;
+            return *this;
+        }
+        IteratorImpl operator++(int) {
+            IteratorImpl tmp = *this;
+            ++index_;
+            return tmp;
+        }
+        IteratorImpl &operator--() {
+            --index_;
+            return *this;
+        }
+        IteratorImpl operator--(int) {
+            IteratorImpl tmp = *this;
+            --index_;
+            return tmp;
+        }
+        IteratorImpl &operator+=(difference_type offset) {
+            index_ += offset;
+            return *this;
+        }
+        IteratorImpl &operator-=(difference_type offset) {
+            index_ -= offset;
+            return *this;
+        }
+        IteratorImpl operator+(difference_type offset) const { return IteratorImpl(container_, index_ + offset); }
+        IteratorImpl operator-(difference_type offset) const { return IteratorImpl(container_, index_ - offset); }
+        difference_type operator-(const IteratorImpl &other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const IteratorImpl &other) const { return index_ == other.index_; }
+        bool operator!=(const IteratorImpl &other) const { return index_ != other.index_; }
+        bool operator<(const IteratorImpl &other) const { return index_ < other.index_; }
+        bool operator>(const IteratorImpl &other) const { return index_ > other.index_; }
+        bool operator<=(const IteratorImpl &other) const { return index_ <= other.index_; }
+        bool operator>=(const IteratorImpl &other) const { return index_ >= other.index_; }
+
+      private:
+        template <typename OtherContainer, typename OtherValue>
+        friend class IteratorImpl;
+        Container *container_ = nullptr;
+        size_type index_ = 0;
+    };
+    using iterator = IteratorImpl<chunked_vector, value_type>;
+    using const_iterator = IteratorImpl<const chunked_vector, const value_type>;
+
+    chunked_vector() = default;
+    chunked_vector(const chunked_vector &other) { append(other.begin(), other.end()); }
+    chunked_vector(chunked_vector &&other) noexcept : chunks_(std::move(other.chunks_)), size_(other.size_) {
+        other.chunks_.clear();
+        other.size_ = 0;
+    }
+    ~chunked_vector() { clear(); }
+
+    chunked_vector &operator=(const chunked_vector &other) {
+        if (this != &other) {
+            clear();
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+    chunked_vector &operator=(chunked_vector &&other) noexcept {
+        if (this != &other) {
+            clear();
+            chunks_ = std::move(other.chunks_);
+            size_ = other.size_;
+            other.chunks_.clear();
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_type capacity() const { return chunks_.size() * kChunkSize; }
+
+    reference operator[](size_type pos) {
+        assert(pos < size_);
+        return chunks_[pos / kChunkSize]->Get(pos % kChunkSize);
+    }
+    const_reference operator[](size_type pos) const {
+        assert(pos < size_);
+        return chunks_[pos / kChunkSize]->Get(pos % kChunkSize);
+    }
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+    reference back() { return (*this)[size_ - 1]; }
+    const_reference back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+    iterator end() { return iterator(this, size_); }
+    const_iterator end() const { return const_iterator(this, size_); }
+    const_iterator cend() const { return const_iterator(this, size_); }
+
+    template <class... Args>
+    reference emplace_back(Args &&...args) {
+        if (size_ == capacity()) {
+            chunks_.emplace_back(std::make_unique<Chunk>());
+        }
+        pointer value = new (chunks_[size_ / kChunkSize]->Address(size_ % kChunkSize)) value_type(std::forward<Args>(args)...);
+        ++size_;
+        return *value;
+    }
+    void push_back(const value_type &value) { emplace_back(value); }
+    void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+    template <typename InputIt>
+    void append(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Allocates the chunks up front, nothing is moved as the chunks already allocated stay where they are
+    void reserve(size_type new_cap) {
+        const size_type chunk_count = (new_cap + kChunkSize - 1) / kChunkSize;
+        chunks_.reserve(chunk_count);
+        while (chunks_.size() < chunk_count) {
+            chunks_.emplace_back(std::make_unique<Chunk>());
+        }
+    }
+
+    void clear() {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < size_; ++i) {
+                (*this)[i].~value_type();
+            }
+        }
+        chunks_.clear();
+        size_ = 0;
+    }
+
+  private:
+    struct Chunk {
+        alignas(value_type) unsigned char storage[sizeof(value_type) * kChunkSize];
+        void *Address(size_type pos) { return storage + pos * sizeof(value_type); }
+        reference Get(size_type pos) { return *std::launder(reinterpret_cast<pointer>(Address(pos))); }
+        const_reference Get(size_type pos) const {
+            return *std::launder(reinterpret_cast<const_pointer>(storage + pos * sizeof(value_type)));
+        }
+    };
+
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    size_type size_ = 0;
+};
+
 // This is a wrapper around unordered_map that optimizes for the common case
 // of only containing a small number of elements. The first N elements are stored
 // inline in the object and don't require hashing or memory (de)allocation.
@@ -407,6 +407,22 @@ void ImageRangeEncoder::Decode(const VkImageSubresource& subres, const IndexType
     out_offset.x = static_cast<int32_t>(static_cast<double>(decode) / texel_sizes_[LowerBoundFromMask(subres.aspectMask)]);
 }
 
+bool ImageRangeEncoder::DecodeSubresource(const IndexType& encode, VkImageSubresource& out_subres) const {
+    for (uint32_t aspect_index = 0; aspect_index < limits_.aspect_index; ++aspect_index) {
+        for (uint32_t mip_level = 0; mip_level < limits_.mipLevel; ++mip_level) {
+            const auto& layout = GetSubresourceInfo(GetSubresourceIndex(aspect_index, mip_level)).layout;
+            if (encode < layout.offset || encode >= layout.offset + layout.size) continue;
+
+            out_subres.aspectMask = AspectBit(aspect_index);
+            out_subres.mipLevel = mip_level;
+            const bool single_layer = is_3_d_ || (layout.arrayPitch == 0);
+            out_subres.arrayLayer = single_layer ? 0U : static_cast<uint32_t>((encode - layout.offset) / layout.arrayPitch);
+            return true;
+        }
+    }
+    return false;
+}
+
 
 inline VkImageSubresourceRange GetRemaining(const VkImageSubresourceRange& full_range, VkImageSubresourceRange subres_range) {
     if (subres_range.levelCount == VK_REMAINING_MIP_LEVELS) {
@@ -372,6 +372,8 @@ class ImageRangeEncoder : public RangeEncoder {
                               const VkOffset3D& offset) const;
     inline IndexType Encode3D(const VkSubresourceLayout& layout, uint32_t aspect_index, const VkOffset3D& offset) const;
     void Decode(const VkImageSubresource& subres, const IndexType& encode, uint32_t& out_layer, VkOffset3D& out_offset) const;
+    // Finds the subresource containing encode, the layer of 3D images is always 0. Returns false if encode is out of the image.
+    bool DecodeSubresource(const IndexType& encode, VkImageSubresource& out_subres) const;
 
     inline uint32_t GetSubresourceIndex(uint32_t aspect_index, uint32_t mip_level) const {
         return mip_level + (aspect_index ? (aspect_index * limits_.mipLevel) : 0U);
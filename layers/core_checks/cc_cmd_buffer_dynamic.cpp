@@ -37,6 +37,119 @@ bool CoreChecks::ValidateDynamicStateIsSet(const CBDynamicFlags& state_status_cb
     return false;
 }
 
+// VUID for a dynamic state of Pipeline::draw_required_dynamic_state not set before a draw
+static const char* GetDynamicStateNotSetVuid(const vvl::DrawDispatchVuid& vuid, CBDynamicState dynamic_state) {
+    switch (dynamic_state) {
+        case CB_DYNAMIC_STATE_CULL_MODE:
+            return vuid.dynamic_cull_mode_07840;
+        case CB_DYNAMIC_STATE_FRONT_FACE:
+            return vuid.dynamic_front_face_07841;
+        case CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY:
+            return vuid.dynamic_primitive_topology_07842;
+        case CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE:
+            return vuid.dynamic_depth_test_enable_07843;
+        case CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE:
+            return vuid.dynamic_depth_write_enable_07844;
+        case CB_DYNAMIC_STATE_DEPTH_COMPARE_OP:
+            return vuid.dynamic_depth_compare_op_07845;
+        case CB_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE:
+            return vuid.dynamic_depth_bound_test_enable_07846;
+        case CB_DYNAMIC_STATE_STENCIL_TEST_ENABLE:
+            return vuid.dynamic_stencil_test_enable_07847;
+        case CB_DYNAMIC_STATE_STENCIL_OP:
+            return vuid.dynamic_stencil_op_07848;
+        case CB_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT:
+            return vuid.patch_control_points_04875;
+        case CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE:
+            return vuid.rasterizer_discard_enable_04876;
+        case CB_DYNAMIC_STATE_DEPTH_BIAS_ENABLE:
+            return vuid.depth_bias_enable_04877;
+        case CB_DYNAMIC_STATE_LOGIC_OP_EXT:
+            return vuid.logic_op_04878;
+        case CB_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE:
+            return vuid.primitive_restart_enable_04879;
+        case CB_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT:
+            return vuid.dynamic_depth_clamp_enable_07620;
+        case CB_DYNAMIC_STATE_POLYGON_MODE_EXT:
+            return vuid.dynamic_polygon_mode_07621;
+        case CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT:
+            return vuid.dynamic_rasterization_samples_07622;
+        case CB_DYNAMIC_STATE_SAMPLE_MASK_EXT:
+            return vuid.dynamic_sample_mask_07623;
+        case CB_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT:
+            return vuid.dynamic_tessellation_domain_origin_07619;
+        case CB_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT:
+            return vuid.dynamic_alpha_to_coverage_enable_07624;
+        case CB_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT:
+            return vuid.dynamic_alpha_to_one_enable_07625;
+        case CB_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT:
+            return vuid.dynamic_logic_op_enable_07626;
+        case CB_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT:
+            return vuid.dynamic_rasterization_stream_07630;
+        case CB_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT:
+            return vuid.dynamic_conservative_rasterization_mode_07631;
+        case CB_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT:
+            return vuid.dynamic_extra_primitive_overestimation_size_07632;
+        case CB_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT:
+            return vuid.dynamic_depth_clip_enable_07633;
+        case CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_ENABLE_EXT:
+            return vuid.dynamic_sample_locations_enable_07634;
+        case CB_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT:
+            return vuid.dynamic_provoking_vertex_mode_07636;
+        case CB_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT:
+            return vuid.dynamic_line_rasterization_mode_07637;
+        case CB_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT:
+            return vuid.dynamic_line_stipple_enable_07638;
+        case CB_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT:
+            return vuid.dynamic_depth_clip_negative_one_to_one_07639;
+        case CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV:
+            return vuid.dynamic_viewport_w_scaling_enable_07640;
+        case CB_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV:
+            return vuid.dynamic_viewport_swizzle_07641;
+        case CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV:
+            return vuid.dynamic_coverage_to_color_enable_07642;
+        case CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV:
+            return vuid.dynamic_coverage_to_color_location_07643;
+        case CB_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV:
+            return vuid.dynamic_coverage_modulation_mode_07644;
+        case CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV:
+            return vuid.dynamic_coverage_modulation_table_enable_07645;
+        case CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV:
+            return vuid.dynamic_coverage_modulation_table_07646;
+        case CB_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV:
+            return vuid.dynamic_shading_rate_image_enable_07647;
+        case CB_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV:
+            return vuid.dynamic_representative_fragment_test_enable_07648;
+        case CB_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV:
+            return vuid.dynamic_coverage_reduction_mode_07649;
+        case CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT:
+            return vuid.dynamic_sample_locations_06666;
+        case CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_ENABLE_NV:
+            return vuid.dynamic_exclusive_scissor_enable_07878;
+        case CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_NV:
+            return vuid.dynamic_exclusive_scissor_07879;
+        case CB_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT:
+            return vuid.dynamic_discard_rectangle_enable_07880;
+        case CB_DYNAMIC_STATE_DISCARD_RECTANGLE_MODE_EXT:
+            return vuid.dynamic_discard_rectangle_mode_07881;
+        case CB_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE:
+            return vuid.vertex_input_binding_stride_04913;
+        case CB_DYNAMIC_STATE_VERTEX_INPUT_EXT:
+            return vuid.vertex_input_04914;
+        case CB_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT:
+            return vuid.dynamic_color_write_enable_07749;
+        case CB_DYNAMIC_STATE_ATTACHMENT_FEEDBACK_LOOP_ENABLE_EXT:
+            return vuid.dynamic_attachment_feedback_loop_08877;
+        case CB_DYNAMIC_STATE_DEPTH_BIAS:
+            return vuid.dynamic_depth_bias_07834;
+        case CB_DYNAMIC_STATE_BLEND_CONSTANTS:
+            return vuid.dynamic_blend_constants_07835;
+        default:
+            assert(false);
+            return kVUIDUndefined;
+    }
+}
+
 // Makes sure the vkCmdSet* call was called correctly prior to a draw
 bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const Location& loc) const {
     bool skip = false;
@@ -56,144 +169,27 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
                          DynamicStatesCommandsToString(unset_status_pipeline).c_str());
     }
 
-    // build the mask of what has been set in the Pipeline, but yet to be set in the Command Buffer
-    const CBDynamicFlags state_status_cb = ~((cb_state.dynamic_state_status.cb ^ pipeline.dynamic_state) & pipeline.dynamic_state);
-
-    // VK_EXT_extended_dynamic_state
-    {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_CULL_MODE, objlist, loc, vuid.dynamic_cull_mode_07840);
-        skip |=
-            ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_FRONT_FACE, objlist, loc, vuid.dynamic_front_face_07841);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY, objlist, loc,
-                                          vuid.dynamic_primitive_topology_07842);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE, objlist, loc,
-                                          vuid.dynamic_depth_test_enable_07843);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE, objlist, loc,
-                                          vuid.dynamic_depth_write_enable_07844);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_COMPARE_OP, objlist, loc,
-                                          vuid.dynamic_depth_compare_op_07845);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE, objlist, loc,
-                                          vuid.dynamic_depth_bound_test_enable_07846);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_STENCIL_TEST_ENABLE, objlist, loc,
-                                          vuid.dynamic_stencil_test_enable_07847);
-        skip |=
-            ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_STENCIL_OP, objlist, loc, vuid.dynamic_stencil_op_07848);
-    }
-
-    // VK_EXT_extended_dynamic_state2
-    {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT, objlist, loc,
-                                          vuid.patch_control_points_04875);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE, objlist, loc,
-                                          vuid.rasterizer_discard_enable_04876);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_BIAS_ENABLE, objlist, loc,
-                                          vuid.depth_bias_enable_04877);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_LOGIC_OP_EXT, objlist, loc, vuid.logic_op_04878);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE, objlist, loc,
-                                          vuid.primitive_restart_enable_04879);
+    // Nothing else can be missing if the pipeline has no dynamic state
+    if (pipeline.dynamic_state.none()) {
+        return skip;
     }
 
-    // VK_EXT_extended_dynamic_state3
-    {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_depth_clamp_enable_07620);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_POLYGON_MODE_EXT, objlist, loc,
-                                          vuid.dynamic_polygon_mode_07621);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT, objlist, loc,
-                                          vuid.dynamic_rasterization_samples_07622);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_SAMPLE_MASK_EXT, objlist, loc,
-                                          vuid.dynamic_sample_mask_07623);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT, objlist, loc,
-                                          vuid.dynamic_tessellation_domain_origin_07619);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_alpha_to_coverage_enable_07624);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_alpha_to_one_enable_07625);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_logic_op_enable_07626);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT, objlist, loc,
-                                          vuid.dynamic_rasterization_stream_07630);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT, objlist, loc,
-                                          vuid.dynamic_conservative_rasterization_mode_07631);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT, objlist, loc,
-                                          vuid.dynamic_extra_primitive_overestimation_size_07632);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_depth_clip_enable_07633);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_sample_locations_enable_07634);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT, objlist, loc,
-                                          vuid.dynamic_provoking_vertex_mode_07636);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT, objlist, loc,
-                                          vuid.dynamic_line_rasterization_mode_07637);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_line_stipple_enable_07638);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT, objlist, loc,
-                                          vuid.dynamic_depth_clip_negative_one_to_one_07639);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV, objlist, loc,
-                                          vuid.dynamic_viewport_w_scaling_enable_07640);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV, objlist, loc,
-                                          vuid.dynamic_viewport_swizzle_07641);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV, objlist, loc,
-                                          vuid.dynamic_coverage_to_color_enable_07642);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV, objlist, loc,
-                                          vuid.dynamic_coverage_to_color_location_07643);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV, objlist, loc,
-                                          vuid.dynamic_coverage_modulation_mode_07644);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV, objlist, loc,
-                                          vuid.dynamic_coverage_modulation_table_enable_07645);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV, objlist, loc,
-                                          vuid.dynamic_coverage_modulation_table_07646);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV, objlist, loc,
-                                          vuid.dynamic_shading_rate_image_enable_07647);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV, objlist, loc,
-                                          vuid.dynamic_representative_fragment_test_enable_07648);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV, objlist, loc,
-                                          vuid.dynamic_coverage_reduction_mode_07649);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT, objlist, loc,
-                                          vuid.dynamic_sample_locations_06666);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_ENABLE_NV, objlist, loc,
-                                          vuid.dynamic_exclusive_scissor_enable_07878);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_NV, objlist, loc,
-                                          vuid.dynamic_exclusive_scissor_07879);
-    }
-
-    // VK_EXT_discard_rectangles
-    {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_discard_rectangle_enable_07880);
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DISCARD_RECTANGLE_MODE_EXT, objlist, loc,
-                                          vuid.dynamic_discard_rectangle_mode_07881);
-    }
+    // build the mask of what has been set in the Pipeline, but yet to be set in the Command Buffer
+    const CBDynamicFlags state_status_cb = ~((cb_state.dynamic_state_status.cb ^ pipeline.dynamic_state) & pipeline.dynamic_state);
 
-    // VK_EXT_vertex_input_dynamic_state
-    {
-        if (!pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT) &&
-            pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT)) {
-            skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE, objlist, loc,
-                                              vuid.vertex_input_binding_stride_04913);
+    // The states the pipeline always needs are known since its creation, only the ones missing in the command buffer are visited
+    const CBDynamicFlags missing_required_states = pipeline.draw_required_dynamic_state & ~cb_state.dynamic_state_status.cb;
+    if (missing_required_states.any()) {
+        for (int state = 1; state < CB_DYNAMIC_STATE_STATUS_NUM; ++state) {
+            if (missing_required_states[state]) {
+                const CBDynamicState dynamic_state = static_cast<CBDynamicState>(state);
+                skip |= ValidateDynamicStateIsSet(state_status_cb, dynamic_state, objlist, loc,
+                                                  GetDynamicStateNotSetVuid(vuid, dynamic_state));
+            }
         }
-        skip |=
-            ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_VERTEX_INPUT_EXT, objlist, loc, vuid.vertex_input_04914);
-    }
-
-    // VK_EXT_color_write_enable
-    {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_color_write_enable_07749);
-    }
-
-    // VK_EXT_attachment_feedback_loop_dynamic_state
-    {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_ATTACHMENT_FEEDBACK_LOOP_ENABLE_EXT, objlist, loc,
-                                          vuid.dynamic_attachment_feedback_loop_08877);
     }
 
     if (const auto* rp_state = pipeline.RasterizationState()) {
-        if (rp_state->depthBiasEnable == VK_TRUE) {
-            skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_BIAS, objlist, loc,
-                                              vuid.dynamic_depth_bias_07834);
-        }
-
         // Any line topology
         const VkPrimitiveTopology topology = last_bound_state.GetPrimitiveTopology();
         if (IsValueIn(topology,
@@ -209,11 +205,6 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
         }
     }
 
-    if (pipeline.BlendConstantsEnabled()) {
-        skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_BLEND_CONSTANTS, objlist, loc,
-                                          vuid.dynamic_blend_constants_07835);
-    }
-
     if (pipeline.DepthStencilState()) {
         if (last_bound_state.IsDepthBoundTestEnable()) {
             skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_DEPTH_BOUNDS, objlist, loc,
@@ -205,9 +205,51 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
         if (layout_map.empty()) continue;
 
         auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
-        const auto *global_map = image_state->layout_range_map.get();
-        assert(global_map);
-        auto global_map_guard = global_map->ReadLock();
+        assert(image_state->layout_range_map);
+        // Lock free, the snapshot stays valid even if a queue retires work on this image in the meantime
+        const auto global_map_snapshot = image_state->layout_range_map->Read();
+        const auto *global_map = global_map_snapshot.get();
+
+        auto validate_initial_layout = [this, &loc, &cb_state, &image_state](const LayoutRange &range,
+                                                                           VkImageLayout initial_layout,
+                                                                           VkImageLayout image_layout) {
+            bool range_skip = false;
+            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                // TODO: Set memory invalid which is in mem_tracker currently
+            } else if (image_layout != initial_layout) {
+                const auto aspect_mask = image_state->subresource_encoder.Decode(range.begin).aspectMask;
+                const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
+                if (!matches) {
+                    // We can report all the errors for the range directly
+                    for (auto index : sparse_container::range_view<LayoutRange>(range)) {
+                        const auto subresource = image_state->subresource_encoder.Decode(index);
+                        const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
+                        range_skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
+                                               "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
+                                               ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
+                                               FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(),
+                                               subresource.aspectMask, subresource.arrayLayer, subresource.mipLevel,
+                                               string_VkImageLayout(initial_layout), string_VkImageLayout(image_layout));
+                    }
+                }
+            }
+            return range_skip;
+        };
+
+        // Fast path: the command buffer uses the whole image in one layout, and the image is currently in one layout
+        const auto &summary = layout_map_entry.second.map->GetSummary();
+        if (summary.whole_image) {
+            const LayoutRange whole_range(0, image_state->subresource_encoder.SubresourceCount());
+            const GlobalImageLayoutRangeMap *current_map = overlay_map->empty() ? global_map : overlay_map;
+            if (current_map->size() == 1 && current_map->begin()->first == whole_range) {
+                skip |= validate_initial_layout(whole_range, summary.initial_layout, current_map->begin()->second);
+                if (summary.current_layout != kInvalidLayout) {
+                    overlay_map->overwrite_range(overlay_map->lower_bound(whole_range),
+                                                 std::make_pair(whole_range, summary.current_layout));
+                }
+                continue;
+            }
+        }
 
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
@@ -232,25 +274,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 image_layout = current_layout->pos_B->lower_bound->second;
             }
             const auto intersected_range = pos->first & current_layout->range;
-            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != initial_layout) {
-                const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
-                const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
-                        skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
-                                         "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
-                                         ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
-                                         FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(), subresource.aspectMask,
-                                         subresource.arrayLayer, subresource.mipLevel, string_VkImageLayout(initial_layout),
-                                         string_VkImageLayout(image_layout));
-                    }
-                }
-            }
+            skip |= validate_initial_layout(intersected_range, initial_layout, image_layout);
             if (pos->first.includes(intersected_range.end)) {
                 current_layout.seek(intersected_range.end);
             } else {
@@ -272,8 +296,18 @@ void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
         const auto image = layout_map_entry.first;
         const auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id && layout_map_entry.second.map) {
-            auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(), GlobalLayoutUpdater());
+            const auto &summary = layout_map_entry.second.map->GetSummary();
+            if (summary.whole_image) {
+                // The whole image ends in a single layout, no need to splice range by range
+                if (summary.current_layout != kInvalidLayout) {
+                    image_state->layout_range_map->SetAll(summary.current_layout);
+                }
+                continue;
+            }
+            const auto &layout_map = layout_map_entry.second.map->GetLayoutMap();
+            image_state->layout_range_map->Update([&layout_map](GlobalImageLayoutRangeMap &global_map) {
+                return sparse_container::splice(global_map, layout_map, GlobalLayoutUpdater());
+            });
         }
     }
 }
@@ -883,10 +917,8 @@ bool CoreChecks::UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer &cb_
 }
 
 bool CoreChecks::FindLayouts(const vvl::Image &image_state, std::vector<VkImageLayout> &layouts) const {
-    const auto *layout_range_map = image_state.layout_range_map.get();
-    if (!layout_range_map) return false;
-
-    auto guard = layout_range_map->ReadLock();
+    if (!image_state.layout_range_map) return false;
+    const auto layout_range_map = image_state.layout_range_map->Read();
     // TODO: FindLayouts function should mutate into a ValidatePresentableLayout with the loop wrapping the LogError
     //       from the caller. You can then use decode to add the subresource of the range::begin to the error message.
 
@@ -1009,8 +1041,8 @@ bool CoreChecks::ValidateHostCopyCurrentLayout(const VkImageLayout expected_layo
 
     CheckState check_state(expected_layout, subres_range.aspectMask);
 
-    auto guard = image_state.layout_range_map->ReadLock();
-    image_state.layout_range_map->AnyInRange(range_gen, [&check_state](const Map::key_type &range, const VkImageLayout &layout) {
+    const auto layout_range_map = image_state.layout_range_map->Read();
+    layout_range_map->AnyInRange(range_gen, [&check_state](const Map::key_type &range, const VkImageLayout &layout) {
         bool mismatch = false;
         if (!ImageLayoutMatches(check_state.aspect_mask, layout, check_state.expected_layout)) {
             check_state.found_range = range;
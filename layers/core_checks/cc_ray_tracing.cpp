@@ -219,7 +219,8 @@ bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectLi
 
 bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
     const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, uint32_t info_i,
-    const VkAccelerationStructureBuildRangeInfoKHR *range_infos, const ErrorObject &error_obj) const {
+    const VkAccelerationStructureBuildRangeInfoKHR *range_infos, const vvl::BufferAddressBatchLookup &scratch_buffers,
+    const ErrorObject &error_obj) const {
     using sparse_container::range;
 
     bool skip = false;
@@ -234,7 +235,7 @@ bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasin
 
     // Cannot compute scratch buffer size from the CPU with indirect calls,
     // so cannot perform validation
-    vvl::span<vvl::Buffer *const> info_scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
+    const vvl::span<vvl::Buffer *const> &info_scratches = scratch_buffers[info_i];
     const VkDeviceSize assumed_scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, range_infos);
 
     if (dst_as_state) {
@@ -263,7 +264,7 @@ bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasin
         const bool other_info_in_update_mode = other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
 
         if (other_dst_as_state) {
-            auto other_info_scratches = GetBuffersByAddress(other_info->scratchData.deviceAddress);
+            const vvl::span<vvl::Buffer *const> &other_info_scratches = scratch_buffers[info_i + 1 + other_info_j];
             const VkDeviceSize assumed_other_scratch_size = rt::ComputeScratchSize(rt_build_type, device, *other_info, range_infos);
 
             const Location other_scratch_loc = other_info_j_loc.dot(Field::scratchData);
@@ -854,6 +855,13 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
         return skip;
     }
 
+    // The scratch buffers of each info are compared with the ones of all the other infos, resolve all their addresses at once
+    std::vector<VkDeviceAddress> scratch_addresses(infoCount);
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        scratch_addresses[info_i] = pInfos[info_i].scratchData.deviceAddress;
+    }
+    const vvl::BufferAddressBatchLookup scratch_buffers = GetBuffersByAddresses(scratch_addresses);
+
     for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
         const Location info_loc = error_obj.location.dot(Field::pInfos, info_i);
 
@@ -904,8 +912,8 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
 
         skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
 
-        skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i,
-                                                                                 ppBuildRangeInfos[info_i], error_obj);
+        skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
+            commandBuffer, infoCount, pInfos, info_i, ppBuildRangeInfos[info_i], scratch_buffers, error_obj);
     }
 
     return skip;
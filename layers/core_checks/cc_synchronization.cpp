@@ -1688,9 +1688,9 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
                 const auto &image_view_image_state = image_view_state->image_state;
 
                 if (img_barrier_image == image_view_image_state->VkHandle()) {
-                    auto guard = image_view_image_state->layout_range_map->ReadLock();
+                    const auto layout_range_map = image_view_image_state->layout_range_map->Read();
 
-                    for (const auto &entry : *image_view_image_state->layout_range_map) {
+                    for (const auto &entry : *layout_range_map) {
                         if (entry.second != VK_IMAGE_LAYOUT_RENDERING_LOCAL_READ_KHR && entry.second != VK_IMAGE_LAYOUT_GENERAL) {
                             const auto &vuid = sync_vuid_maps::GetShaderTileImageVUID(
                                 barrier_loc, sync_vuid_maps::ShaderTileImageError::kShaderTileImageLayout);
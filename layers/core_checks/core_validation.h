@@ -1433,9 +1433,11 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t infoCount,
                                                        const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, uint32_t info_i,
                                                        const ErrorObject& error_obj) const;
+    // scratch_buffers holds the buffers found at the scratch address of each pInfos element
     bool ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
         const LogObjectList& objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
-        uint32_t info_i, const VkAccelerationStructureBuildRangeInfoKHR* range_infos, const ErrorObject& error_obj) const;
+        uint32_t info_i, const VkAccelerationStructureBuildRangeInfoKHR* range_infos,
+        const vvl::BufferAddressBatchLookup& scratch_buffers, const ErrorObject& error_obj) const;
     bool PreCallValidateCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                           const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                           const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos,
@@ -17,10 +17,13 @@
 
 #include "gpu_validation/debug_printf.h"
 #include "spirv-tools/instrument.hpp"
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include "generated/layer_chassis_dispatch.h"
 #include "utils/shader_utils.h"
 #include "chassis/chassis_modification_state.h"
+#include "gpu_validation/spirv/module.h"
 
 // Perform initializations that can be done at Create Device time.
 void debug_printf::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
@@ -41,6 +44,11 @@ void debug_printf::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo
         use_stdout = true;
     }
 
+    if (!printf_settings.output_file.empty() && !record_sink_.Open(printf_settings.output_file)) {
+        LogWarning("WARNING-DEBUG-PRINTF", device, loc, "Unable to open %s, Debug Printf messages will be formatted instead.",
+                   printf_settings.output_file.c_str());
+    }
+
     const uint32_t kDebugOutputPrintfStream = 3;  // from instrument.hpp
     VkDescriptorSetLayoutBinding binding = {kDebugOutputPrintfStream, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
                                             kShaderStageAllGraphics | VK_SHADER_STAGE_COMPUTE_BIT | kShaderStageAllRayTracing,
@@ -83,6 +91,13 @@ bool debug_printf::Validator::InstrumentShader(const vvl::span<const uint32_t> &
     instrumented_spirv.reserve(input.size());
     instrumented_spirv.insert(instrumented_spirv.end(), &input.front(), &input.back() + 1);
 
+    // Only the selected invocation reaches the DebugPrintf instructions, the other invocations never write a record
+    if (!printf_settings.invocation_filter.empty()) {
+        gpuav::spirv::Module module(instrumented_spirv, unique_shader_id, desc_set_bind_index);
+        module.RunPassDebugPrintfFilter(printf_settings.invocation_filter);
+        module.ToBinary(instrumented_spirv);
+    }
+
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
@@ -112,6 +127,8 @@ bool debug_printf::Validator::InstrumentShader(const vvl::span<const uint32_t> &
     const bool pass = optimizer.Run(instrumented_spirv.data(), instrumented_spirv.size(), &instrumented_spirv, opt_options);
     if (!pass) {
         InternalError(device, loc, "Failure to instrument shader in spirv-opt. Proceeding with non-instrumented shader.");
+    } else {
+        InternFormatStrings(input, unique_shader_id);
     }
     return pass;
 }
@@ -253,15 +270,80 @@ std::vector<debug_printf::Substring> debug_printf::Validator::ParseFormatString(
     return parsed_strings;
 }
 
-std::string debug_printf::Validator::FindFormatString(const std::vector<spirv::Instruction> &instructions, uint32_t string_id) {
-    std::string format_string;
+static constexpr uint32_t kDebugPrintfInstruction = 1;  // from NonSemantic.DebugPrintf grammar
+
+// Parse every format string used by the shader once, when it is instrumented
+void debug_printf::Validator::InternFormatStrings(const vvl::span<const uint32_t> &spirv, uint32_t unique_shader_id) {
+    std::vector<spirv::Instruction> instructions;
+    spirv::GenerateInstructions(spirv, instructions);
+
+    uint32_t debug_printf_set_id = 0;
+    vvl::unordered_map<uint32_t, const char *> strings;
+    vvl::unordered_set<uint32_t> format_string_ids;
     for (const spirv::Instruction &insn : instructions) {
-        if (insn.Opcode() == spv::OpString && insn.Word(1) == string_id) {
-            format_string = insn.GetAsString(2);
-            break;
+        if (insn.Opcode() == spv::OpString) {
+            strings[insn.Word(1)] = insn.GetAsString(2);
+        } else if (insn.Opcode() == spv::OpExtInstImport) {
+            if (strcmp(insn.GetAsString(2), "NonSemantic.DebugPrintf") == 0) {
+                debug_printf_set_id = insn.Word(1);
+            }
+        } else if (insn.Opcode() == spv::OpExtInst && insn.Word(3) == debug_printf_set_id &&
+                   insn.Word(4) == kDebugPrintfInstruction) {
+            format_string_ids.insert(insn.Word(5));
+        }
+    }
+
+    const std::vector<std::string> long_specifiers = {"%ul", "%lu", "%lx"};
+    for (const uint32_t string_id : format_string_ids) {
+        auto string_it = strings.find(string_id);
+        if (string_it == strings.end()) {
+            continue;
+        }
+        auto format_string = std::make_shared<FormatString>();
+        format_string->string = string_it->second;
+        format_string->substrings = ParseFormatString(format_string->string);
+        for (Substring &substring : format_string->substrings) {
+            for (const std::string &long_specifier : long_specifiers) {
+                const size_t long_pos = substring.string.find(long_specifier);
+                if (long_pos != std::string::npos) {
+                    substring.string.replace(long_pos + 1, 2, long_specifier == "%lu" ? PRIu64 : PRIx64);
+                    substring.is_64_bit = true;
+                    break;
+                }
+            }
+            if (substring.is_64_bit) {
+                format_string->value_word_count += 2;
+            } else if (substring.needs_value) {
+                format_string->value_word_count += 1;
+            }
         }
+
+        const uint64_t key = (static_cast<uint64_t>(unique_shader_id) << 32) | string_id;
+        std::unique_lock<std::mutex> lock(format_strings_lock_);
+        format_strings_[key] = std::move(format_string);
     }
-    return format_string;
+    std::unique_lock<std::mutex> lock(format_strings_lock_);
+    interned_shader_ids_.insert(unique_shader_id);
+}
+
+// The instrumented shaders cache skips InstrumentShader(), which interns the format strings. Shaders cached earlier in this run
+// already have them, but shaders from a cache loaded from disk do not.
+void debug_printf::Validator::OnCachedInstrumentedShader(const vvl::span<const uint32_t> &input, uint32_t unique_shader_id) {
+    {
+        std::unique_lock<std::mutex> lock(format_strings_lock_);
+        if (interned_shader_ids_.count(unique_shader_id) != 0) {
+            return;
+        }
+    }
+    InternFormatStrings(input, unique_shader_id);
+}
+
+std::shared_ptr<const debug_printf::FormatString> debug_printf::Validator::GetFormatString(uint32_t unique_shader_id,
+                                                                                           uint32_t string_id) {
+    const uint64_t key = (static_cast<uint64_t>(unique_shader_id) << 32) | string_id;
+    std::unique_lock<std::mutex> lock(format_strings_lock_);
+    auto it = format_strings_.find(key);
+    return it != format_strings_.end() ? it->second : nullptr;
 }
 
 // GCC and clang don't like using variables as format strings in sprintf.
@@ -285,93 +367,109 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
     uint32_t expect = debug_output_buffer[1];
     if (!expect) return;
 
-    uint32_t index = spvtools::kDebugOutputDataOffset;
-    while (debug_output_buffer[index]) {
-        std::stringstream shader_message;
-        VkShaderModule shader_module_handle = VK_NULL_HANDLE;
-        VkPipeline pipeline_handle = VK_NULL_HANDLE;
-        VkShaderEXT shader_object_handle = VK_NULL_HANDLE;
-        vvl::span<const uint32_t> instrumented_spirv;
+    const uint32_t buffer_word_count = static_cast<uint32_t>(output_buffer_byte_size / sizeof(uint32_t));
+    const uint32_t record_header_word_count = static_cast<uint32_t>(offsetof(OutputRecord, values) / sizeof(uint32_t));
+    // When streaming to a file, the raw records are copied and the messages are formatted offline
+    std::vector<uint32_t> sink_records;
+    std::vector<uint64_t> sink_format_string_keys;
+    // Reported once per buffer, all the records of a shader would be missing
+    bool missing_format_string = false;
 
+    uint32_t index = spvtools::kDebugOutputDataOffset;
+    while (index < buffer_word_count && debug_output_buffer[index]) {
         OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[index]);
-        // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
-        // by the instrumented shader.
-        auto it = shader_map.find(debug_record->shader_id);
-        if (it != shader_map.end()) {
-            shader_module_handle = it->second.shader_module;
-            pipeline_handle = it->second.pipeline;
-            shader_object_handle = it->second.shader_object;
-            instrumented_spirv = it->second.instrumented_spirv;
+        if (debug_record->size < record_header_word_count || index + debug_record->size > buffer_word_count) {
+            break;
+        }
+
+        if (record_sink_.IsOpen()) {
+            sink_format_string_keys.emplace_back((static_cast<uint64_t>(debug_record->shader_id) << 32) |
+                                                 debug_record->format_string_id);
+            RecordSink::AppendRecord(sink_records, &debug_output_buffer[index], debug_record->size);
+            index += debug_record->size;
+            continue;
+        }
+
+        // The format string was parsed when the shader was instrumented
+        const std::shared_ptr<const FormatString> format_string =
+            GetFormatString(debug_record->shader_id, debug_record->format_string_id);
+        if (!format_string) {
+            if (!missing_format_string) {
+                InternalError(queue, loc, "Unable to find the format string of a DebugPrintf record, the record is dropped.");
+                missing_format_string = true;
+            }
+            index += debug_record->size;
+            continue;
         }
-        assert(instrumented_spirv.size() != 0);
-        std::vector<spirv::Instruction> instructions;
-        spirv::GenerateInstructions(instrumented_spirv, instructions);
-
-        // Search through the shader source for the printf format string for this invocation
-        const std::string format_string = FindFormatString(instructions, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
-        void *values = static_cast<void *>(&debug_record->values);
+        if (debug_record->size < record_header_word_count + format_string->value_word_count) {
+            index += debug_record->size;
+            continue;
+        }
+
+        std::stringstream shader_message;
+        const uint32_t *values = &debug_record->values;
         // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
+        for (const Substring &substring : format_string->substrings) {
             std::string temp_string;
             size_t needed = 0;
-            std::vector<std::string> format_strings = {"%ul", "%lu", "%lx"};
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (const auto &ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
-                }
-            }
-            if (ul_pos != std::string::npos) {
+            if (substring.is_64_bit) {
                 // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
-                values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
-                }
+                uint64_t long_value = 0;
+                std::memcpy(&long_value, values, sizeof(uint64_t));
+                values += 2;
                 // +1 for null terminator
-                needed = std::snprintf(nullptr, 0, substring.string.c_str(), substring.longval) + 1;
+                needed = std::snprintf(nullptr, 0, substring.string.c_str(), long_value) + 1;
                 temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str(), substring.longval);
-            } else {
-                if (substring.needs_value) {
-                    switch (substring.type) {
-                        case varunsigned:
-                            // +1 for null terminator
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<uint32_t *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<uint32_t *>(values));
-                            break;
-
-                        case varsigned:
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<int32_t *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<int32_t *>(values));
-                            break;
-
-                        case varfloat:
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<float *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<float *>(values));
-                            break;
-                    }
-                    values = static_cast<uint32_t *>(values) + 1;
-                } else {
-                    needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
-                    temp_string.resize(needed);
-                    std::snprintf(&temp_string[0], needed, substring.string.c_str());
+                std::snprintf(&temp_string[0], needed, substring.string.c_str(), long_value);
+            } else if (substring.needs_value) {
+                switch (substring.type) {
+                    case varunsigned:
+                        // +1 for null terminator
+                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), *values) + 1;
+                        temp_string.resize(needed);
+                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), *values);
+                        break;
+
+                    case varsigned:
+                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), *reinterpret_cast<const int32_t *>(values)) + 1;
+                        temp_string.resize(needed);
+                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), *reinterpret_cast<const int32_t *>(values));
+                        break;
+
+                    case varfloat:
+                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), *reinterpret_cast<const float *>(values)) + 1;
+                        temp_string.resize(needed);
+                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), *reinterpret_cast<const float *>(values));
+                        break;
                 }
+                values += 1;
+            } else {
+                needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
+                temp_string.resize(needed);
+                std::snprintf(&temp_string[0], needed, substring.string.c_str());
             }
             shader_message << temp_string.c_str();
         }
 
         if (verbose) {
+            VkShaderModule shader_module_handle = VK_NULL_HANDLE;
+            VkPipeline pipeline_handle = VK_NULL_HANDLE;
+            VkShaderEXT shader_object_handle = VK_NULL_HANDLE;
+            vvl::span<const uint32_t> instrumented_spirv;
+            // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value
+            // returned by the instrumented shader.
+            auto it = shader_map.find(debug_record->shader_id);
+            if (it != shader_map.end()) {
+                shader_module_handle = it->second.shader_module;
+                pipeline_handle = it->second.pipeline;
+                shader_object_handle = it->second.shader_object;
+                instrumented_spirv = it->second.instrumented_spirv;
+            }
+            assert(instrumented_spirv.size() != 0);
+            // Only needed for the source line, the format string doesn't require going through the shader
+            std::vector<spirv::Instruction> instructions;
+            spirv::GenerateInstructions(instrumented_spirv, instructions);
+
             std::string common_message;
             std::string filename_message;
             std::string source_message;
@@ -396,6 +494,25 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
         }
         index += debug_record->size;
     }
+
+    if (!sink_records.empty()) {
+        // Queued under the lock, so a format string is always in the file before any record using it
+        std::unique_lock<std::mutex> lock(format_strings_lock_);
+        std::vector<uint32_t> sink_chunks;
+        for (const uint64_t key : sink_format_string_keys) {
+            if (!streamed_format_strings_.insert(key).second) {
+                continue;
+            }
+            auto it = format_strings_.find(key);
+            if (it != format_strings_.end()) {
+                RecordSink::AppendFormatString(sink_chunks, static_cast<uint32_t>(key >> 32), static_cast<uint32_t>(key),
+                                               it->second->string);
+            }
+        }
+        sink_chunks.insert(sink_chunks.end(), sink_records.begin(), sink_records.end());
+        record_sink_.Write(sink_chunks);
+    }
+
     if ((index - spvtools::kDebugOutputDataOffset) != expect) {
         LogWarning("WARNING-DEBUG-PRINTF", queue, loc,
                    "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the message");
@@ -20,6 +20,9 @@
 #include "gpu_validation/gpu_state_tracker.h"
 #include "gpu_validation/gpu_shader_instrumentor.h"
 #include "gpu_validation/gpu_error_message.h"
+#include "gpu_validation/debug_printf_sink.h"
+#include <memory>
+#include <mutex>
 
 namespace debug_printf {
 
@@ -45,7 +48,17 @@ struct Substring {
     std::string string;
     bool needs_value;
     vartype type;
-    uint64_t longval = 0;
+    // %ul, %lu and %lx read 2 words, the string already has the matching PRIx64/PRIu64 specifier
+    bool is_64_bit = false;
+};
+
+// Format strings are interned when the shader is instrumented, so a record only has to look up its already parsed format string.
+// The record itself is still the one written by the spirv-opt pass, with a full word per value.
+struct FormatString {
+    std::string string;
+    std::vector<Substring> substrings;
+    // Number of value words a record using this format string holds
+    uint32_t value_word_count = 0;
 };
 
 struct OutputRecord {
@@ -90,6 +103,7 @@ class Validator : public GpuShaderInstrumentor {
     void CreateDevice(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
     bool InstrumentShader(const vvl::span<const uint32_t>& input, std::vector<uint32_t>& instrumented_spirv,
                           uint32_t unique_shader_id, const Location& loc) override;
+    void OnCachedInstrumentedShader(const vvl::span<const uint32_t>& input, uint32_t unique_shader_id) override;
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          const RecordObject& record_obj, chassis::CreateShaderModule& chassis_state) override;
@@ -97,7 +111,8 @@ class Validator : public GpuShaderInstrumentor {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     std::vector<Substring> ParseFormatString(const std::string& format_string);
-    std::string FindFormatString(const std::vector<spirv::Instruction>& instructions, uint32_t string_id);
+    void InternFormatStrings(const vvl::span<const uint32_t>& spirv, uint32_t unique_shader_id);
+    std::shared_ptr<const FormatString> GetFormatString(uint32_t unique_shader_id, uint32_t string_id);
     void AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo& buffer_info, uint32_t operation_index,
                                    uint32_t* const debug_output_buffer, const Location& loc);
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
@@ -186,5 +201,15 @@ class Validator : public GpuShaderInstrumentor {
   private:
     bool verbose = false;
     bool use_stdout = false;
+
+    // Shaders can be instrumented and command buffers retired from several threads
+    std::mutex format_strings_lock_;
+    // < unique shader id << 32 | OpString id, format string >
+    vvl::unordered_map<uint64_t, std::shared_ptr<const FormatString>> format_strings_;
+    // Shaders whose format strings are in format_strings_, including shaders without any
+    vvl::unordered_set<uint32_t> interned_shader_ids_;
+    // Format strings already written to record_sink_
+    vvl::unordered_set<uint64_t> streamed_format_strings_;
+    RecordSink record_sink_;
 };
 }  // namespace debug_printf
@@ -0,0 +1,95 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation/debug_printf_sink.h"
+
+namespace debug_printf {
+
+RecordSink::~RecordSink() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+bool RecordSink::Open(const std::string &path) {
+    file_.open(path, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    if (!file_) {
+        return false;
+    }
+    const uint32_t header[2] = {kFileMagic, kFileVersion};
+    file_.write(reinterpret_cast<const char *>(header), sizeof(header));
+    thread_ = std::thread(&RecordSink::WriterThread, this);
+    return true;
+}
+
+void RecordSink::AppendFormatString(std::vector<uint32_t> &chunks, uint32_t shader_id, uint32_t string_id,
+                                    const std::string &format_string) {
+    // +1 for the null terminator
+    const uint32_t string_words = static_cast<uint32_t>((format_string.size() + 1 + 3) / 4);
+    chunks.emplace_back(kChunkFormatString);
+    chunks.emplace_back(2 + string_words);
+    chunks.emplace_back(shader_id);
+    chunks.emplace_back(string_id);
+    const size_t string_offset = chunks.size();
+    chunks.resize(string_offset + string_words, 0);
+    for (size_t i = 0; i < format_string.size(); i++) {
+        chunks[string_offset + i / 4] |= static_cast<uint32_t>(static_cast<uint8_t>(format_string[i])) << (8 * (i % 4));
+    }
+}
+
+void RecordSink::AppendRecord(std::vector<uint32_t> &chunks, const uint32_t *record, uint32_t word_count) {
+    chunks.emplace_back(kChunkRecord);
+    chunks.emplace_back(word_count);
+    chunks.insert(chunks.end(), record, record + word_count);
+}
+
+void RecordSink::Write(const std::vector<uint32_t> &chunks) {
+    if (chunks.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        pending_.insert(pending_.end(), chunks.begin(), chunks.end());
+    }
+    cv_.notify_one();
+}
+
+void RecordSink::WriterThread() {
+    std::vector<uint32_t> writing;
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        cv_.wait(guard, [this] { return exit_ || !pending_.empty(); });
+        if (pending_.empty()) {
+            break;  // exit_ is set and everything was written
+        }
+        // Swap buffers so the retire threads can keep queueing while the file is written
+        writing.swap(pending_);
+        guard.unlock();
+        file_.write(reinterpret_cast<const char *>(writing.data()), static_cast<std::streamsize>(writing.size() * sizeof(uint32_t)));
+        writing.clear();
+        guard.lock();
+    }
+    file_.flush();
+}
+
+}  // namespace debug_printf
@@ -0,0 +1,69 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace debug_printf {
+
+// Streams the raw Debug Printf records to a file, the messages are formatted offline instead of when the command buffer retires.
+//
+// The file is a sequence of little-endian uint32_t words. It starts with kFileMagic and kFileVersion, followed by chunks:
+//
+//     <chunk kind> <payload word count> <payload>
+//
+//     kChunkFormatString: <shader id> <OpString id> <null terminated UTF-8 string, padded to a word>
+//     kChunkRecord:       <record words as written by the instrumented shader, starting with the record size>
+//
+// A format string chunk is always written before the first record using it.
+class RecordSink {
+  public:
+    static constexpr uint32_t kFileMagic = 0x46505656;  // "VVPF"
+    static constexpr uint32_t kFileVersion = 1;
+    static constexpr uint32_t kChunkFormatString = 1;
+    static constexpr uint32_t kChunkRecord = 2;
+
+    ~RecordSink();
+
+    bool Open(const std::string &path);
+    bool IsOpen() const { return thread_.joinable(); }
+
+    static void AppendFormatString(std::vector<uint32_t> &chunks, uint32_t shader_id, uint32_t string_id,
+                                   const std::string &format_string);
+    static void AppendRecord(std::vector<uint32_t> &chunks, const uint32_t *record, uint32_t word_count);
+
+    // Only queues the chunks, the file is written by a background thread so retiring a command buffer never waits on file IO
+    void Write(const std::vector<uint32_t> &chunks);
+
+  private:
+    void WriterThread();
+
+    std::ofstream file_;
+    std::thread thread_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::vector<uint32_t> pending_;
+    bool exit_ = false;
+};
+
+}  // namespace debug_printf
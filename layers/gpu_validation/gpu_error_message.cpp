@@ -555,7 +555,7 @@ bool Validator::LogMessageInstRayQuery(const uint32_t *error_record, std::string
 // keeps a copy, but it can be destroyed after the pipeline is created and before it is submitted.)
 //
 bool Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue queue, CommandResources &cmd_resources,
-                                          uint32_t operation_index, uint32_t *const error_record,
+                                          uint32_t operation_index, uint32_t *const error_record, uint32_t error_hit_count,
                                           const std::vector<DescSetState> &descriptor_sets, const Location &loc) {
     // The second word in the debug output buffer is the number of words that would have
     // been written by the shader instrumentation, if there was enough room in the buffer we provided.
@@ -602,6 +602,19 @@ bool Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue qu
             instrumented_spirv = it->second.instrumented_spirv;
         }
 
+        if (shader_profile.IsActive()) {
+            // Debug utils names end up as a comment in the written profile, making it easier to read
+            std::string shader_description;
+            if (pipeline_handle != VK_NULL_HANDLE) {
+                shader_description = FormatHandle(pipeline_handle);
+            } else if (shader_object_handle != VK_NULL_HANDLE) {
+                shader_description = FormatHandle(shader_object_handle);
+            } else if (shader_module_handle != VK_NULL_HANDLE) {
+                shader_description = FormatHandle(shader_module_handle);
+            }
+            shader_profile.RecordError(error_record[glsl::kHeaderShaderIdOffset], shader_description);
+        }
+
         std::vector<spirv::Instruction> instructions;
         spirv::GenerateInstructions(instrumented_spirv, instructions);
 
@@ -613,6 +626,10 @@ bool Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue qu
         UtilGenerateCommonMessage(debug_report, cmd_buffer, error_record, shader_module_handle, pipeline_handle,
                                   shader_object_handle, cmd_resources.pipeline_bind_point, operation_index, common_message);
         UtilGenerateSourceMessages(instructions, error_record, false, filename_message, source_message);
+        if (error_hit_count > 1) {
+            // With error deduplication, the records of a same error site are reported once
+            error_msg += " (Reported " + std::to_string(error_hit_count) + " times in this submission.)";
+        }
 
         if (cmd_resources.uses_robustness && oob_access) {
             if (gpuav_settings.warn_on_robust_oob) {
@@ -630,11 +647,11 @@ bool Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue qu
 
 bool CommandResources::LogValidationMessage(Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
                                             uint32_t *output_buffer_begin, const uint32_t operation_index,
-                                            const LogObjectList &objlist) {
+                                            uint32_t error_hit_count, const LogObjectList &objlist) {
     const DescBindingInfo *di_info = desc_binding_index != vvl::kU32Max ? &(*desc_binding_list)[desc_binding_index] : nullptr;
     const Location loc(command);
     bool error_logged =
-        validator.AnalyzeAndGenerateMessage(cmd_buffer, queue, *this, operation_index, output_buffer_begin,
+        validator.AnalyzeAndGenerateMessage(cmd_buffer, queue, *this, operation_index, output_buffer_begin, error_hit_count,
                                             di_info ? di_info->descriptor_set_buffers : std::vector<DescSetState>(), loc);
 
     if (!error_logged) {
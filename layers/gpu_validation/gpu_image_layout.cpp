@@ -88,8 +88,9 @@ void Validator::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
         }
         auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id) {
-            auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            image_state->layout_range_map->Update([&subres_map](GlobalImageLayoutRangeMap &global_map) {
+                return sparse_container::splice(global_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            });
         }
     }
 }
@@ -669,10 +670,10 @@ bool Validator::VerifyImageLayoutRange(const vvl::CommandBuffer &cb_state, const
         return skip;
     }
     const auto &layout_map = subresource_map->GetLayoutMap();
-    const auto *global_map = image_state.layout_range_map.get();
+    assert(image_state.layout_range_map);
+    const auto global_map_snapshot = image_state.layout_range_map->Read();
+    const auto *global_map = global_map_snapshot.get();
     GlobalImageLayoutRangeMap empty_map(1);
-    assert(global_map);
-    auto global_map_guard = global_map->ReadLock();
 
     auto pos = layout_map.begin();
     const auto end = layout_map.end();
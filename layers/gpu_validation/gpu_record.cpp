@@ -114,10 +114,16 @@ void Validator::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderM
                                                 const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) {
     BaseClass::PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
     if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfo->pNext)) return;
+    // Only the shader profile and the instrumented shader cache identify shaders by hash
+    const bool use_shader_hash = shader_profile.IsActive() || gpuav_settings.cache_instrumented_shaders;
+    const uint32_t shader_hash = use_shader_hash ? hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize) : 0;
+    if (shader_profile.IsActive() && !shader_profile.SelectShader(shader_hash)) return;
     uint32_t shader_id;
     if (gpuav_settings.cache_instrumented_shaders) {
-        const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
-        if (gpuav_settings.cache_instrumented_shaders && CheckForCachedInstrumentedShader(shader_hash, chassis_state)) {
+        if (CheckForCachedInstrumentedShader(shader_hash, chassis_state)) {
+            if (shader_profile.IsActive()) {
+                shader_profile.TrackInstrumentedShader(shader_hash, shader_hash);
+            }
             return;
         }
         shader_id = shader_hash;
@@ -130,6 +136,9 @@ void Validator::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderM
         chassis_state.instrumented_create_info.pCode = chassis_state.instrumented_spirv.data();
         chassis_state.instrumented_create_info.codeSize = chassis_state.instrumented_spirv.size() * sizeof(uint32_t);
         chassis_state.unique_shader_id = shader_id;
+        if (shader_profile.IsActive()) {
+            shader_profile.TrackInstrumentedShader(shader_id, shader_hash);
+        }
         if (gpuav_settings.cache_instrumented_shaders) {
             instrumented_shaders.emplace(shader_id,
                                          std::make_pair(chassis_state.instrumented_spirv.size(), chassis_state.instrumented_spirv));
@@ -142,28 +151,53 @@ void Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createIn
                                               const RecordObject &record_obj, chassis::ShaderObject &chassis_state) {
     BaseClass::PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                              chassis_state);
+    // Shaders are independent, gather the ones needing instrumentation to instrument them concurrently
+    std::vector<InstrumentationJob> jobs;
+    std::vector<uint32_t> job_create_info_indices;
+    std::vector<uint32_t> job_shader_hashes;
+    const bool use_shader_hash = shader_profile.IsActive() || gpuav_settings.cache_instrumented_shaders;
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfos[i].pNext)) continue;
+        const uint32_t shader_hash =
+            use_shader_hash ? hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize) : 0;
+        if (shader_profile.IsActive() && !shader_profile.SelectShader(shader_hash)) continue;
         if (gpuav_settings.cache_instrumented_shaders) {
-            const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
-            if (CheckForCachedInstrumentedShader(i, chassis_state.unique_shader_ids[i], chassis_state)) {
+            if (CheckForCachedInstrumentedShader(i, shader_hash, chassis_state)) {
+                chassis_state.unique_shader_ids[i] = shader_hash;
+                if (shader_profile.IsActive()) {
+                    shader_profile.TrackInstrumentedShader(shader_hash, shader_hash);
+                }
                 continue;
             }
             chassis_state.unique_shader_ids[i] = shader_hash;
         } else {
             chassis_state.unique_shader_ids[i] = unique_shader_module_id++;
         }
-        const bool pass = InstrumentShader(
+        jobs.emplace_back(InstrumentationJob{
             vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)),
-            chassis_state.instrumented_spirv[i], chassis_state.unique_shader_ids[i], record_obj.location);
-        if (pass) {
-            chassis_state.instrumented_create_info[i].pCode = chassis_state.instrumented_spirv[i].data();
-            chassis_state.instrumented_create_info[i].codeSize = chassis_state.instrumented_spirv[i].size() * sizeof(uint32_t);
-            if (gpuav_settings.cache_instrumented_shaders) {
-                instrumented_shaders.emplace(
-                    chassis_state.unique_shader_ids[i],
-                    std::make_pair(chassis_state.instrumented_spirv[i].size(), chassis_state.instrumented_spirv[i]));
-            }
+            chassis_state.unique_shader_ids[i],
+            {},
+            false});
+        job_create_info_indices.emplace_back(i);
+        job_shader_hashes.emplace_back(shader_hash);
+    }
+
+    InstrumentShaders(jobs, record_obj.location);
+
+    for (size_t job_i = 0; job_i < jobs.size(); ++job_i) {
+        InstrumentationJob &job = jobs[job_i];
+        if (!job.pass) continue;
+        const uint32_t i = job_create_info_indices[job_i];
+        chassis_state.instrumented_spirv[i] = std::move(job.instrumented_spirv);
+        chassis_state.instrumented_create_info[i].pCode = chassis_state.instrumented_spirv[i].data();
+        chassis_state.instrumented_create_info[i].codeSize = chassis_state.instrumented_spirv[i].size() * sizeof(uint32_t);
+        if (shader_profile.IsActive()) {
+            shader_profile.TrackInstrumentedShader(chassis_state.unique_shader_ids[i], job_shader_hashes[job_i]);
+        }
+        if (gpuav_settings.cache_instrumented_shaders) {
+            instrumented_shaders.emplace(
+                chassis_state.unique_shader_ids[i],
+                std::make_pair(chassis_state.instrumented_spirv[i].size(), chassis_state.instrumented_spirv[i]));
         }
     }
 }
@@ -176,6 +210,11 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
         shared_resources->Destroy(*this);
     }
 
+    if (shader_profile.IsActive() && !shader_profile.Save(gpuav_settings.shader_profile)) {
+        LogWarning("WARNING-GPU-Assisted-Validation", device, record_obj.location, "Unable to write GPU-AV shader profile %s.",
+                   gpuav_settings.shader_profile.c_str());
+    }
+
     if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders.empty()) {
         std::ofstream file_stream(instrumented_shader_cache_path, std::ofstream::out | std::ofstream::binary);
         if (file_stream) {
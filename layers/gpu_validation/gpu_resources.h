@@ -48,8 +48,9 @@ class CommandResources {
     CommandResources &operator=(const CommandResources &) = default;
 
     // Return iff an error was logged
+    // error_hit_count is the number of records written for the error site in the submission, 0 if unknown
     bool LogValidationMessage(Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, uint32_t *error_record,
-                              const uint32_t operation_index, const LogObjectList &objlist);
+                              const uint32_t operation_index, uint32_t error_hit_count, const LogObjectList &objlist);
     // Return iff an error was logged
     virtual bool LogCustomValidationMessage(Validator &validator, const uint32_t *error_record, const uint32_t operation_index,
                                             const LogObjectList &objlist) {
@@ -18,6 +18,8 @@
 #pragma once
 // Default values for those settings should match layers/VkLayer_khronos_validation.json.in
 
+#include <string>
+#include <vector>
 #include "generated/gpu_inst_shader_hash.h"
 
 struct GpuAVSettings {
@@ -29,6 +31,8 @@ struct GpuAVSettings {
     bool validate_ray_query = true;
     bool cache_instrumented_shaders = true;
     bool select_instrumented_shaders = false;
+    std::string shader_profile{};
+    bool error_deduplication = false;
 
     bool buffers_validation_enabled = true;
     bool validate_indirect_draws_buffers = true;
@@ -51,6 +55,8 @@ struct GpuAVSettings {
         // Because of those 2 settings, cannot really have an "enabled" parameter to pass to this method
         cache_instrumented_shaders = false;
         select_instrumented_shaders = false;
+        shader_profile.clear();
+        error_deduplication = false;
     }
     bool IsBufferValidationEnabled() const {
         return validate_indirect_draws_buffers || validate_indirect_dispatches_buffers || validate_indirect_trace_rays_buffers ||
@@ -66,8 +72,15 @@ struct GpuAVSettings {
 
 #pragma pack(push, 1)
 struct ShaderCacheHash {
-    ShaderCacheHash(const GpuAVSettings& gpuav_settings) : gpuav_settings(gpuav_settings) {}
-    GpuAVSettings gpuav_settings{};
+    ShaderCacheHash(const GpuAVSettings& gpuav_settings)
+        : validate_descriptors(gpuav_settings.validate_descriptors),
+          validate_bda(gpuav_settings.validate_bda),
+          validate_ray_query(gpuav_settings.validate_ray_query) {}
+    // Only the settings changing the instrumented SPIR-V are part of the hash,
+    // GpuAVSettings itself is not trivially copyable
+    bool validate_descriptors;
+    bool validate_bda;
+    bool validate_ray_query;
     const char inst_shader_git_hash[sizeof(INST_SHADER_GIT_HASH)] = INST_SHADER_GIT_HASH;
 };
 #pragma pack(pop)
@@ -76,4 +89,7 @@ struct DebugPrintfSettings {
     bool to_stdout = false;
     bool verbose = false;
     uint32_t buffer_size = 1024;
+    std::string output_file{};
+    // Pixel (x, y) or invocation id (x, y, z) allowed to print, empty allows all invocations
+    std::vector<uint32_t> invocation_filter{};
 };
\ No newline at end of file
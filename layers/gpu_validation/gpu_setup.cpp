@@ -250,6 +250,14 @@ void Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locati
         }
     }
 
+    if (!gpuav_settings.shader_profile.empty()) {
+        std::string error_message;
+        if (!shader_profile.Load(gpuav_settings.shader_profile, error_message)) {
+            LogWarning("WARNING-GPU-Assisted-Validation", device, loc, "%s. All shaders will be instrumented.",
+                       error_message.c_str());
+        }
+    }
+
     // Create command indices buffer
     {
         VkBufferCreateInfo buffer_info = vku::InitStructHelper();
@@ -19,6 +19,8 @@
 #include "gpu_validation/gpu_state_tracker.h"
 #include "chassis/chassis_modification_state.h"
 
+#include <algorithm>
+
 // Implementation for Descriptor Set Manager class
 DescriptorSetManager::DescriptorSetManager(VkDevice device, uint32_t num_bindings_in_set)
     : device(device), num_bindings_in_set(num_bindings_in_set) {}
@@ -782,6 +784,25 @@ bool GpuShaderInstrumentor::CheckForGpuAvEnabled(const void *pNext) {
     return false;
 }
 
+void GpuShaderInstrumentor::InstrumentShaders(std::vector<InstrumentationJob> &jobs, const Location &loc) {
+    if (jobs.size() <= 1 || !thread_pool) {
+        for (auto &job : jobs) {
+            job.pass = InstrumentShader(job.input, job.instrumented_spirv, job.unique_shader_id, loc);
+        }
+        return;
+    }
+
+    // The calling thread runs jobs too while it waits
+    vvl::ThreadPool::TaskGroup group;
+    for (auto &job : jobs) {
+        thread_pool->Submit(
+            "GPU-AV shader instrumentation",
+            [this, &job, &loc]() { job.pass = InstrumentShader(job.input, job.instrumented_spirv, job.unique_shader_id, loc); },
+            &group);
+    }
+    thread_pool->Wait(group);
+}
+
 // Examine the pipelines to see if they use the debug descriptor set binding index.
 // If any do, create new non-instrumented shader modules and use them to replace the instrumented
 // shaders in the pipeline.  Return the (possibly) modified create infos to the caller.
@@ -791,6 +812,23 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
                                                            PipelineStates &pipeline_states,
                                                            std::vector<SafeCreateInfo> *new_pipeline_create_infos,
                                                            const RecordObject &record_obj, ChassisState &chassis_state) {
+    // Shaders defined at pipeline creation time are gathered while walking the pipelines, then instrumented all at once
+    struct PendingShader {
+        uint32_t pipeline;
+        VkShaderStageFlagBits stage;
+        std::shared_ptr<vvl::ShaderModule> module_state;
+        uint32_t shader_hash;
+        uint32_t job_index;  // vvl::kU32Max when found in the cache
+        std::vector<uint32_t> cached_spirv;
+    };
+    std::vector<PendingShader> pending_shaders;
+    std::vector<InstrumentationJob> jobs;
+    // < unique shader id, job index >, so a shader used by several stages of the batch is only instrumented once
+    vvl::unordered_map<uint32_t, uint32_t> job_map;
+    const size_t first_create_info = new_pipeline_create_infos->size();
+    // Only the shader profile and the instrumented shader cache identify shaders by hash
+    const bool use_shader_hash = shader_profile.IsActive() || gpuav_settings.cache_instrumented_shaders;
+
     // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
     // descriptor set index.
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
@@ -846,37 +884,33 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
                             reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
                                 vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
                         if (gpuav_settings.select_instrumented_shaders && sm_ci && !CheckForGpuAvEnabled(sm_ci->pNext)) continue;
+                        // Hashed once, the shader profile and the instrumented shader cache use the same hash
+                        const uint32_t shader_hash =
+                            use_shader_hash ? hash_util::ShaderHash(module_state->spirv->words_.data(),
+                                                                    module_state->spirv->words_.size() * sizeof(uint32_t))
+                                            : 0;
+                        if (shader_profile.IsActive() && !shader_profile.SelectShader(shader_hash)) continue;
                         uint32_t unique_shader_id = 0;
-                        bool cached = false;
-                        bool pass = false;
-                        std::vector<uint32_t> instrumented_spirv;
+                        PendingShader pending{pipeline, stage, module_state, shader_hash, vvl::kU32Max, {}};
                         if (gpuav_settings.cache_instrumented_shaders) {
-                            unique_shader_id =
-                                hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
+                            unique_shader_id = shader_hash;
                             auto it = instrumented_shaders.find(unique_shader_id);
                             if (it != instrumented_shaders.end()) {
-                                instrumented_spirv = it->second.second;
-                                cached = true;
+                                pending.cached_spirv = it->second.second;
+                                OnCachedInstrumentedShader(module_state->spirv->words_, unique_shader_id);
+                            } else {
+                                auto [job_it, inserted] = job_map.try_emplace(unique_shader_id, static_cast<uint32_t>(jobs.size()));
+                                if (inserted) {
+                                    jobs.emplace_back(InstrumentationJob{module_state->spirv->words_, unique_shader_id, {}, false});
+                                }
+                                pending.job_index = job_it->second;
                             }
                         } else {
                             unique_shader_id = unique_shader_module_id++;
+                            pending.job_index = static_cast<uint32_t>(jobs.size());
+                            jobs.emplace_back(InstrumentationJob{module_state->spirv->words_, unique_shader_id, {}, false});
                         }
-                        if (!cached) {
-                            pass = InstrumentShader(module_state->spirv->words_, instrumented_spirv, unique_shader_id,
-                                                    record_obj.location);
-                        }
-                        if (cached || pass) {
-                            module_state->gpu_validation_shader_id = unique_shader_id;
-                            // Now we need to update the shader code in VkShaderModuleCreateInfo
-                            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
-                            if (sm_ci) {
-                                sm_ci->SetCode(instrumented_spirv);
-                            }
-                            if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                                instrumented_shaders.emplace(unique_shader_id,
-                                                             std::make_pair(instrumented_spirv.size(), instrumented_spirv));
-                            }
-                        }
+                        pending_shaders.emplace_back(std::move(pending));
 
                         chassis_state.shader_unique_id_maps[pipeline][stage] = unique_shader_id;
                     }
@@ -885,6 +919,42 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
         }
         new_pipeline_create_infos->push_back(std::move(new_pipeline_ci));
     }
+
+    InstrumentShaders(jobs, record_obj.location);
+
+    for (PendingShader &pending : pending_shaders) {
+        const bool cached = pending.job_index == vvl::kU32Max;
+        if (!cached && !jobs[pending.job_index].pass) {
+            continue;
+        }
+        const std::vector<uint32_t> &instrumented_spirv =
+            cached ? pending.cached_spirv : jobs[pending.job_index].instrumented_spirv;
+        const uint32_t unique_shader_id = chassis_state.shader_unique_id_maps[pending.pipeline][pending.stage];
+
+        pending.module_state->gpu_validation_shader_id = unique_shader_id;
+        if (shader_profile.IsActive()) {
+            shader_profile.TrackInstrumentedShader(unique_shader_id, pending.shader_hash);
+        }
+        // Now we need to update the shader code in VkShaderModuleCreateInfo
+        // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
+        auto &new_pipeline_ci = (*new_pipeline_create_infos)[first_create_info + pending.pipeline];
+        auto &stage_ci =
+            GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(new_pipeline_ci, pending.stage);
+        auto sm_ci = const_cast<vku::safe_VkShaderModuleCreateInfo *>(reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
+            vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+        if (sm_ci) {
+            sm_ci->SetCode(instrumented_spirv);
+        }
+    }
+
+    if (gpuav_settings.cache_instrumented_shaders) {
+        for (auto &job : jobs) {
+            if (job.pass) {
+                const size_t spirv_size = job.instrumented_spirv.size();
+                instrumented_shaders.emplace(job.unique_shader_id, std::make_pair(spirv_size, std::move(job.instrumented_spirv)));
+            }
+        }
+    }
 }
 // For every pipeline:
 // - For every shader in a pipeline:
@@ -929,6 +999,7 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreations(const uint32_t count
 
 void GpuShaderInstrumentor::InternalError(LogObjectList objlist, const Location &loc, const char *const specific_message,
                                           bool vma_fail) const {
+    std::unique_lock<std::mutex> guard(internal_error_lock_);
     aborted = true;
     std::string error_message = specific_message;
     if (vma_fail) {
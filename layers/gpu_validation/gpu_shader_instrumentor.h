@@ -18,6 +18,7 @@
 #include "generated/chassis.h"
 #include "gpu_validation/gpu_resources.h"
 #include "gpu_validation/gpu_state_tracker.h"
+#include "gpu_validation/gpu_shader_profile.h"
 #include "vma/vma.h"
 
 class DescriptorSetManager {
@@ -158,6 +159,21 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     // GPU-AV and DebugPrint are going to have a different way to do the actual shader instrumentation logic
     virtual bool InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &instrumented_spirv,
                                   uint32_t unique_shader_id, const Location &loc) = 0;
+    // Called instead of InstrumentShader() when the instrumented SPIR-V is found in the instrumented shaders cache, so the
+    // information InstrumentShader() gathers from the original SPIR-V is still available
+    virtual void OnCachedInstrumentedShader(const vvl::span<const uint32_t> &input, uint32_t unique_shader_id) {}
+
+    struct InstrumentationJob {
+        vvl::span<const uint32_t> input;
+        uint32_t unique_shader_id = 0;
+        std::vector<uint32_t> instrumented_spirv;
+        bool pass = false;
+    };
+    // Instruments independent shaders on the device thread pool, used when a single call (ex. vkCreateShadersEXT) provides many
+    // shaders.
+    // Shader IDs are assigned by the caller before and results are read back in order after, so the instrumented SPIR-V does
+    // not depend on how the jobs were scheduled.
+    void InstrumentShaders(std::vector<InstrumentationJob> &jobs, const Location &loc);
 
     VkDescriptorSetLayout GetDebugDescriptorSetLayout() { return debug_desc_layout_; }
     VkPipelineLayout GetDebugPipelineLayout() { return debug_pipeline_layout_; }
@@ -182,6 +198,7 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     VmaPool output_buffer_pool = VK_NULL_HANDLE;
     std::unique_ptr<DescriptorSetManager> desc_set_manager;
     vvl::concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
+    gpuav::ShaderProfile shader_profile;
     std::vector<VkDescriptorSetLayoutBinding> validation_bindings_;
 
     gpuav::DeviceMemoryBlock indices_buffer{};
@@ -193,4 +210,6 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     // These are objects used to inject our descriptor set into the command buffer
     VkDescriptorSetLayout debug_desc_layout_ = VK_NULL_HANDLE;
     VkPipelineLayout debug_pipeline_layout_ = VK_NULL_HANDLE;
+    // Shaders can be instrumented on several threads at once
+    mutable std::mutex internal_error_lock_;
 };
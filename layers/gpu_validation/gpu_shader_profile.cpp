@@ -0,0 +1,149 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation/gpu_shader_profile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace gpuav {
+
+bool ShaderProfile::Load(const std::string &path, std::string &error_message) {
+    std::unique_lock<std::mutex> guard(lock_);
+    // The profile is only active (and thus written back at device destruction) if it was loaded successfully, a file that
+    // could not be parsed is left untouched instead of being overwritten by a profile built from scratch
+    active_ = false;
+    entries_.clear();
+
+    std::ifstream file_stream(path);
+    if (!file_stream) {
+        active_ = true;
+        return true;
+    }
+
+    vvl::unordered_map<uint32_t, Entry> entries;
+
+    std::string line;
+    uint32_t line_number = 0;
+    while (std::getline(file_stream, line)) {
+        ++line_number;
+        std::string comment;
+        const auto comment_pos = line.find('#');
+        if (comment_pos != std::string::npos) {
+            comment = line.substr(comment_pos + 1);
+            line.resize(comment_pos);
+        }
+
+        std::istringstream line_stream(line);
+        std::string hash_str;
+        std::string mode_str;
+        uint64_t error_count = 0;
+        if (!(line_stream >> hash_str)) {
+            continue;  // Empty or comment only line
+        }
+        if (!(line_stream >> mode_str >> error_count) || (mode_str != "instrument" && mode_str != "skip")) {
+            error_message = "Invalid entry at line " + std::to_string(line_number) + " of GPU-AV shader profile " + path;
+            return false;
+        }
+
+        uint32_t shader_hash = 0;
+        try {
+            shader_hash = static_cast<uint32_t>(std::stoul(hash_str, nullptr, 0));
+        } catch (...) {
+            error_message = "Invalid shader hash \"" + hash_str + "\" at line " + std::to_string(line_number) +
+                            " of GPU-AV shader profile " + path;
+            return false;
+        }
+
+        Entry &entry = entries[shader_hash];
+        entry.mode = mode_str == "instrument" ? Mode::Instrument : Mode::Skip;
+        entry.error_count = error_count;
+        entry.comment = std::move(comment);
+    }
+    entries_ = std::move(entries);
+    active_ = true;
+    return true;
+}
+
+bool ShaderProfile::Save(const std::string &path) const {
+    std::unique_lock<std::mutex> guard(lock_);
+    std::ofstream file_stream(path, std::ofstream::out | std::ofstream::trunc);
+    if (!file_stream) {
+        return false;
+    }
+
+    // Sort by hash so consecutive runs produce diff-able profiles
+    std::vector<uint32_t> hashes;
+    hashes.reserve(entries_.size());
+    for (const auto &[hash, entry] : entries_) {
+        hashes.emplace_back(hash);
+    }
+    std::sort(hashes.begin(), hashes.end());
+
+    file_stream << "# GPU-AV shader profile\n";
+    file_stream << "# <shader hash> <instrument|skip> <error count>\n";
+    for (const uint32_t hash : hashes) {
+        const Entry &entry = entries_.at(hash);
+        const uint64_t error_count = entry.error_count + entry.new_error_count;
+        Mode mode = entry.mode;
+        if (entry.new_error_count > 0) {
+            mode = Mode::Instrument;
+        } else if (entry.instrumented && error_count == 0) {
+            // Instrumented and never found an error: this shader is cold for the next run. Shaders with an error history keep
+            // being instrumented, a clean run does not prove the bug is gone.
+            mode = Mode::Skip;
+        }
+
+        file_stream << "0x" << std::hex << hash << std::dec << (mode == Mode::Instrument ? " instrument " : " skip ")
+                    << error_count;
+        if (!entry.comment.empty()) {
+            file_stream << " #" << entry.comment;
+        }
+        file_stream << '\n';
+    }
+    return static_cast<bool>(file_stream);
+}
+
+bool ShaderProfile::SelectShader(uint32_t shader_hash) {
+    std::unique_lock<std::mutex> guard(lock_);
+    auto [it, inserted] = entries_.try_emplace(shader_hash);
+    // Shaders not in the profile yet are new or modified, they are always instrumented
+    return inserted || it->second.mode == Mode::Instrument;
+}
+
+void ShaderProfile::TrackInstrumentedShader(uint32_t unique_shader_id, uint32_t shader_hash) {
+    std::unique_lock<std::mutex> guard(lock_);
+    shader_id_to_hash_[unique_shader_id] = shader_hash;
+    entries_[shader_hash].instrumented = true;
+}
+
+void ShaderProfile::RecordError(uint32_t unique_shader_id, const std::string &description) {
+    std::unique_lock<std::mutex> guard(lock_);
+    auto hash_it = shader_id_to_hash_.find(unique_shader_id);
+    if (hash_it == shader_id_to_hash_.end()) {
+        return;
+    }
+    Entry &entry = entries_[hash_it->second];
+    ++entry.new_error_count;
+    if (!description.empty()) {
+        entry.comment = " " + description;
+    }
+}
+
+}  // namespace gpuav
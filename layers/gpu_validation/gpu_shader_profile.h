@@ -0,0 +1,69 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "containers/custom_containers.h"
+
+namespace gpuav {
+
+// A "hot/cold" shader profile, used to only instrument shaders that either have a history of GPU-AV errors or that are new since
+// the profile was written (a modified shader gets a new hash).
+//
+// The profile is a text file, one shader per line:
+//
+//     <shader hash> <instrument|skip> <error count>  # optional comment
+//
+// At device destruction, the profile is written back with the error counts of the run added. Shaders that were instrumented
+// and never reported an error are flipped to "skip", shaders with an error history stay "instrument".
+// A profile that failed to load is never written back.
+class ShaderProfile {
+  public:
+    enum class Mode { Instrument, Skip };
+
+    // Returns false if the file exists but could not be parsed, in which case the profile stays inactive.
+    // A missing file is not an error, it means all shaders are new.
+    bool Load(const std::string &path, std::string &error_message);
+    bool Save(const std::string &path) const;
+
+    bool IsActive() const { return active_; }
+
+    // Returns true if the shader should be instrumented, and remembers the shader so it is part of the written profile
+    bool SelectShader(uint32_t shader_hash);
+    // Instrumented shaders are identified by their unique shader id in the error records, not necessarily by their hash
+    void TrackInstrumentedShader(uint32_t unique_shader_id, uint32_t shader_hash);
+    void RecordError(uint32_t unique_shader_id, const std::string &description);
+
+  private:
+    struct Entry {
+        Mode mode = Mode::Instrument;
+        uint64_t error_count = 0;
+        // Information gathered during this run
+        bool instrumented = false;
+        uint64_t new_error_count = 0;
+        std::string comment;
+    };
+
+    bool active_ = false;
+    mutable std::mutex lock_;
+    vvl::unordered_map<uint32_t, Entry> entries_;
+    vvl::unordered_map<uint32_t, uint32_t> shader_id_to_hash_;
+};
+
+}  // namespace gpuav
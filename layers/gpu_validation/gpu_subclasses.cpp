@@ -280,7 +280,9 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     auto gpuav = static_cast<Validator *>(&dev_data);
 
     // By supplying a "date"
-    if (!gpuav->gpuav_settings.validate_bda || bda_ranges_snapshot_version_ == gpuav->buffer_device_address_ranges_version) {
+    // Read before the ranges: if they change while being copied, the next update will see a newer version and copy them again
+    const uint32_t ranges_version = gpuav->GetBufferAddressRangesVersion();
+    if (!gpuav->gpuav_settings.validate_bda || bda_ranges_snapshot_version_ == ranges_version) {
         return true;
     }
 
@@ -328,7 +330,7 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // Flush the BDA buffer before un-mapping so that the new state is visible to the GPU
     result = vmaFlushAllocation(gpuav->vmaAllocator, bda_ranges_snapshot_.allocation, 0, VK_WHOLE_SIZE);
     vmaUnmapMemory(gpuav->vmaAllocator, bda_ranges_snapshot_.allocation);
-    bda_ranges_snapshot_version_ = gpuav->buffer_device_address_ranges_version;
+    bda_ranges_snapshot_version_ = ranges_version;
 
     return true;
 }
@@ -422,6 +424,16 @@ bool CommandBuffer::PreProcess() {
 
 bool CommandBuffer::NeedsPostProcess() { return !error_output_buffer_.IsNull(); }
 
+// Identifies the shader instruction and the error it reported
+static uint32_t ErrorSiteKey(const uint32_t *error_record) {
+    uint32_t key = 0x811c9dc5u;
+    key = (key ^ error_record[glsl::kHeaderShaderIdOffset]) * 0x01000193u;
+    key = (key ^ error_record[glsl::kHeaderInstructionIdOffset]) * 0x01000193u;
+    key = (key ^ error_record[glsl::kHeaderErrorGroupOffset]) * 0x01000193u;
+    key = (key ^ error_record[glsl::kHeaderErrorSubCodeOffset]) * 0x01000193u;
+    return key;
+}
+
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
 void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     // CommandBuffer::Destroy can happen on an other thread,
@@ -451,16 +463,42 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
             uint32_t *const error_records_end =
                 error_output_buffer_ptr + (gpuav->output_buffer_byte_size - cst::stream_output_data_offset);
 
+            // Instrumentation writes a record per invocation hitting an error, with error deduplication
+            // the records of an error site are merged into a single error reporting their count.
+            vvl::unordered_map<uint32_t, uint32_t> error_site_records;
+            if (gpuav->gpuav_settings.error_deduplication) {
+                uint32_t *error_record = error_records_start;
+                uint32_t record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
+                while (record_size > 0 && (error_record + record_size) <= error_records_end) {
+                    ++error_site_records[ErrorSiteKey(error_record)];
+                    error_record += record_size;
+                    record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
+                }
+            }
+
             uint32_t *error_record = error_records_start;
             uint32_t record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
             assert(record_size == glsl::kErrorRecordSize);
 
             while (record_size > 0 && (error_record + record_size) <= error_records_end) {
+                uint32_t error_hit_count = 0;
+                if (gpuav->gpuav_settings.error_deduplication) {
+                    auto site_records = error_site_records.find(ErrorSiteKey(error_record));
+                    if (site_records->second == 0) {
+                        // Already reported
+                        error_record += record_size;
+                        record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
+                        continue;
+                    }
+                    error_hit_count = site_records->second;
+                    site_records->second = 0;
+                }
                 const uint32_t resource_index = error_record[glsl::kHeaderCommandResourceIdOffset];
                 assert(resource_index < per_command_resources.size());
                 auto &cmd_info = per_command_resources[resource_index];
                 const LogObjectList objlist(queue, VkHandle());
-                cmd_info->LogValidationMessage(*gpuav, queue, VkHandle(), error_record, cmd_info->operation_index, objlist);
+                cmd_info->LogValidationMessage(*gpuav, queue, VkHandle(), error_record, cmd_info->operation_index,
+                                               error_hit_count, objlist);
 
                 // Next record
                 error_record += record_size;
@@ -176,7 +176,7 @@ class Validator : public GpuShaderInstrumentor {
   public:
     // Return true iff a error has been found
     bool AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue queue, CommandResources& cmd_resources,
-                                   uint32_t operation_index, uint32_t* const error_record,
+                                   uint32_t operation_index, uint32_t* const error_record, uint32_t error_hit_count,
                                    const std::vector<DescSetState>& descriptor_sets, const Location& loc);
 
   private:
@@ -22,15 +22,17 @@
 namespace gpuav {
 namespace spirv {
 
-static LinkInfo link_info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size,
-                             LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
+static const LinkInfo link_info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size,
+                                   LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t BindlessDescriptorPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        // Shaders can be instrumented concurrently, only the module's copy is updated
+        LinkInfo module_link_info = link_info;
+        module_link_info.function_id = link_function_id;
+        module_.link_info_.push_back(module_link_info);
     }
     return link_function_id;
 }
@@ -422,6 +424,15 @@ bool BindlessDescriptorPass::AnalyzeInstruction(const Function& function, const
     // Save information to be used to make the Function
     target_instruction_ = &inst;
 
+    // Loads and stores through the same access chain indexes (ex. "data[i] += 1") validate the same bytes of the same descriptor.
+    // Image accesses are not shared as CreateFunctionCall might need to copy the OpSampledImage into the new block.
+    if (!image_inst_) {
+        check_key_ = {descriptor_set_, descriptor_binding_};
+        for (uint32_t i = 3; i < access_chain_inst_->Length(); i++) {
+            check_key_.push_back(access_chain_inst_->Word(i));
+        }
+    }
+
     return true;
 }
 
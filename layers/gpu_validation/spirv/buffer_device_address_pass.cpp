@@ -22,15 +22,17 @@
 namespace gpuav {
 namespace spirv {
 
-static LinkInfo link_info = {inst_buffer_device_address_comp, inst_buffer_device_address_comp_size,
-                             LinkFunctions::inst_buffer_device_address, 0, "inst_buffer_device_address"};
+static const LinkInfo link_info = {inst_buffer_device_address_comp, inst_buffer_device_address_comp_size,
+                                   LinkFunctions::inst_buffer_device_address, 0, "inst_buffer_device_address"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t BufferDeviceAddressPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        // Shaders can be instrumented concurrently, only the module's copy is updated
+        LinkInfo module_link_info = link_info;
+        module_link_info.function_id = link_function_id;
+        module_.link_info_.push_back(module_link_info);
     }
     return link_function_id;
 }
@@ -98,6 +100,12 @@ bool BufferDeviceAddressPass::AnalyzeInstruction(const Function& function, const
     // Save information to be used to make the Function
     target_instruction_ = &inst;
     type_length_ = module_.type_manager_.TypeLength(*accessed_type);
+
+    // Accesses of the same length through the same base pointer and indexes validate the same address range
+    check_key_ = {type_length_};
+    for (uint32_t i = 3; i < pointer_inst->Length(); i++) {
+        check_key_.push_back(pointer_inst->Word(i));
+    }
     return true;
 }
 
@@ -0,0 +1,135 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "debug_printf_filter_pass.h"
+#include "module.h"
+#include <spirv/unified1/spirv.hpp>
+#include <string>
+
+namespace gpuav {
+namespace spirv {
+
+static constexpr uint32_t kDebugPrintfInstruction = 1;  // from NonSemantic.DebugPrintf grammar
+
+static std::string GetImportName(const Instruction& import_inst) {
+    std::string name;
+    for (uint32_t i = 2; i < import_inst.Length(); i++) {
+        const uint32_t word = import_inst.Word(i);
+        for (uint32_t byte = 0; byte < 4; byte++) {
+            const char c = static_cast<char>((word >> (8 * byte)) & 0xFF);
+            if (c == '\0') {
+                return name;
+            }
+            name.push_back(c);
+        }
+    }
+    return name;
+}
+
+DebugPrintfFilterPass::DebugPrintfFilterPass(Module& module, const std::vector<uint32_t>& invocation_id)
+    : Pass(module), invocation_id_(invocation_id) {
+    for (const auto& import_inst : module_.ext_inst_imports_) {
+        if (GetImportName(*import_inst) == "NonSemantic.DebugPrintf") {
+            debug_printf_set_id_ = import_inst->ResultId();
+            break;
+        }
+    }
+
+    // Like for the stage info, can't know which entry point a function is called from with multiple entry points
+    if (module_.entry_points_.size() != 1) {
+        return;
+    }
+    switch (spv::ExecutionModel(module_.entry_points_.begin()->get()->Operand(0))) {
+        case spv::ExecutionModelFragment:
+            built_in_ = spv::BuiltInFragCoord;
+            is_fragment_ = true;
+            supported_stage_ = true;
+            break;
+        case spv::ExecutionModelGLCompute:
+        case spv::ExecutionModelTaskNV:
+        case spv::ExecutionModelMeshNV:
+        case spv::ExecutionModelTaskEXT:
+        case spv::ExecutionModelMeshEXT:
+            built_in_ = spv::BuiltInGlobalInvocationId;
+            supported_stage_ = true;
+            break;
+        case spv::ExecutionModelRayGenerationKHR:
+        case spv::ExecutionModelIntersectionKHR:
+        case spv::ExecutionModelAnyHitKHR:
+        case spv::ExecutionModelClosestHitKHR:
+        case spv::ExecutionModelMissKHR:
+        case spv::ExecutionModelCallableKHR:
+            built_in_ = spv::BuiltInLaunchIdKHR;
+            supported_stage_ = true;
+            break;
+        default:
+            break;
+    }
+}
+
+bool DebugPrintfFilterPass::AnalyzeInstruction(const Function&, const Instruction& inst) {
+    if (!supported_stage_ || debug_printf_set_id_ == 0 || invocation_id_.empty()) {
+        return false;
+    }
+    if (inst.Opcode() != spv::OpExtInst || inst.Word(3) != debug_printf_set_id_ || inst.Word(4) != kDebugPrintfInstruction) {
+        return false;
+    }
+    // Every printf of a block compares against the same invocation, the first comparison is reused
+    check_key_ = {debug_printf_set_id_};
+    return true;
+}
+
+uint32_t DebugPrintfFilterPass::CreateFunctionCall(BasicBlock& block) {
+    TypeManager& type_manager = module_.type_manager_;
+    const Type& bool_type = type_manager.GetTypeBool();
+    const Type& uint32_type = type_manager.GetTypeInt(32, false);
+
+    const Variable& variable = GetBuiltinVariable(built_in_);
+    const Type* pointer_type = variable.PointerType(type_manager);
+    const uint32_t load_id = module_.TakeNextId();
+    block.CreateInstruction(spv::OpLoad, {pointer_type->Id(), load_id, variable.Id()});
+
+    // FragCoord is a vec4 at the pixel center, the others are uvec3
+    const uint32_t component_count = is_fragment_ ? 2 : 3;
+    uint32_t result_id = 0;
+    for (uint32_t i = 0; i < component_count && i < invocation_id_.size(); i++) {
+        uint32_t component_id = module_.TakeNextId();
+        if (is_fragment_) {
+            const Type& float32_type = type_manager.GetTypeFloat(32);
+            block.CreateInstruction(spv::OpCompositeExtract, {float32_type.Id(), component_id, load_id, i});
+            const uint32_t convert_id = module_.TakeNextId();
+            block.CreateInstruction(spv::OpConvertFToU, {uint32_type.Id(), convert_id, component_id});
+            component_id = convert_id;
+        } else {
+            block.CreateInstruction(spv::OpCompositeExtract, {uint32_type.Id(), component_id, load_id, i});
+        }
+
+        const uint32_t expected_id = type_manager.GetConstantUInt32(invocation_id_[i]).Id();
+        const uint32_t equal_id = module_.TakeNextId();
+        block.CreateInstruction(spv::OpIEqual, {bool_type.Id(), equal_id, component_id, expected_id});
+
+        if (result_id == 0) {
+            result_id = equal_id;
+        } else {
+            const uint32_t and_id = module_.TakeNextId();
+            block.CreateInstruction(spv::OpLogicalAnd, {bool_type.Id(), and_id, result_id, equal_id});
+            result_id = and_id;
+        }
+    }
+    return result_id;
+}
+
+}  // namespace spirv
+}  // namespace gpuav
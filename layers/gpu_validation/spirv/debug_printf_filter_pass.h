@@ -0,0 +1,51 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "pass.h"
+
+namespace gpuav {
+namespace spirv {
+
+class Module;
+struct Function;
+struct BasicBlock;
+
+// Create a pass to only let a single invocation reach the NonSemantic.DebugPrintf instructions.
+// The invocation is selected by its pixel (FragCoord.xy), GlobalInvocationId or LaunchIdKHR, any component not given matches all
+// invocations. This runs before the DebugPrintf instrumentation, so filtered out invocations never write into the output buffer.
+class DebugPrintfFilterPass : public Pass {
+  public:
+    DebugPrintfFilterPass(Module& module, const std::vector<uint32_t>& invocation_id);
+
+  private:
+    bool AnalyzeInstruction(const Function& function, const Instruction& inst) final;
+    // There is no function to link, the comparison with the built-in is done inline
+    uint32_t CreateFunctionCall(BasicBlock& block) final;
+    void Reset() final {}
+
+    const std::vector<uint32_t>& invocation_id_;
+    // OpExtInstImport "NonSemantic.DebugPrintf", zero if the module has no printf
+    uint32_t debug_printf_set_id_ = 0;
+    // If the stage is not supported, the DebugPrintf instructions are left untouched
+    bool supported_stage_ = false;
+    bool is_fragment_ = false;
+    spv::BuiltIn built_in_ = spv::BuiltInMax;
+};
+
+}  // namespace spirv
+}  // namespace gpuav
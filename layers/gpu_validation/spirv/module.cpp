@@ -20,6 +20,7 @@
 #include "buffer_device_address_pass.h"
 #include "bindless_descriptor_pass.h"
 #include "ray_query_pass.h"
+#include "debug_printf_filter_pass.h"
 
 namespace gpuav {
 namespace spirv {
@@ -209,6 +210,11 @@ void Module::RunPassRayQuery() {
     pass.Run();
 }
 
+void Module::RunPassDebugPrintfFilter(const std::vector<uint32_t>& invocation_id) {
+    DebugPrintfFilterPass pass(*this, invocation_id);
+    pass.Run();
+}
+
 uint32_t Module::TakeNextId() {
     // SPIR-V limit.
     assert(header_.bound < 0x3FFFFF);
@@ -73,6 +73,7 @@ class Module {
     void RunPassBindlessDescriptor();
     void RunPassBufferDeviceAddress();
     void RunPassRayQuery();
+    void RunPassDebugPrintfFilter(const std::vector<uint32_t>& invocation_id);
 
     // Helpers
     bool HasCapability(spv::Capability capability);
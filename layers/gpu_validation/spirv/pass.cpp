@@ -293,10 +293,12 @@ BasicBlockIt Pass::InjectFunctionCheck(Function* function, BasicBlockIt block_it
 
     // If thre is a result, we need to create an additional BasicBlock to hold the |else| case, then after we create a Phi node to
     // hold the result
+    // (OpExtInst always has a result, even when it is a OpTypeVoid nothing can use)
     const uint32_t target_inst_id = target_inst.ResultId();
-    if (target_inst_id != 0) {
+    const Type* target_inst_type = module_.type_manager_.FindTypeById(target_inst.TypeId());
+    if (target_inst_id != 0 && target_inst_type && target_inst_type->spv_type_ != SpvType::kVoid) {
         const uint32_t phi_id = module_.TakeNextId();
-        const Type& phi_type = *module_.type_manager_.FindTypeById(target_inst.TypeId());
+        const Type& phi_type = *target_inst_type;
         uint32_t null_id = 0;
         // Can't create ConstantNull of pointer type, so convert uint64 zero to pointer
         if (phi_type.spv_type_ == SpvType::kPointer) {
@@ -347,20 +349,47 @@ BasicBlockIt Pass::InjectFunctionCheck(Function* function, BasicBlockIt block_it
     original_block.instructions_.erase(inst_it, original_block.instructions_.end());
 
     // Go back to original Block and add function call and branch from the bool result
-    const uint32_t function_result = CreateFunctionCall(original_block);
+    // If an identical check was already done earlier in the block, there is no need to call the function again
+    uint32_t function_result = FindBlockCheck();
+    if (function_result == 0) {
+        function_result = CreateFunctionCall(original_block);
+        if (!check_key_.empty()) {
+            block_checks_.emplace_back(check_key_, function_result);
+        }
+    }
 
     original_block.CreateInstruction(spv::OpSelectionMerge, {merge_block_label, spv::SelectionControlMaskNone});
     original_block.CreateInstruction(spv::OpBranchConditional, {function_result, valid_block_label, invalid_block_label});
 
     // clear values incase multiple calls are made
     Reset();
+    check_key_.clear();
 
     return block_it;
 }
 
+uint32_t Pass::FindBlockCheck() const {
+    if (check_key_.empty()) {
+        return 0;
+    }
+    for (const auto& [key, function_result] : block_checks_) {
+        if (key == check_key_) {
+            return function_result;
+        }
+    }
+    return 0;
+}
+
 void Pass::Run() {
     for (const auto& function : module_.functions_) {
+        // When a check is injected, the remaining instructions are moved to a new merge block, dominated by the check
+        bool in_split_block = false;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
+            if (!in_split_block) {
+                block_checks_.clear();
+            }
+            in_split_block = false;
+
             if ((*block_it)->loop_header_) {
                 continue;  // Currently can't properly handle injecting CFG logic into a loop header block
             }
@@ -371,6 +400,7 @@ void Pass::Run() {
 
                     // will start searching again from newly split merge block
                     block_it--;
+                    in_split_block = true;
                     break;
                 }
             }
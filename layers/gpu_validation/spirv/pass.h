@@ -15,6 +15,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <utility>
+#include <vector>
 #include <spirv/unified1/spirv.hpp>
 #include "function_basic_block.h"
 
@@ -56,6 +58,19 @@ class Pass {
     // Each pass creates a OpFunctionCall and returns its result id.
     virtual uint32_t CreateFunctionCall(BasicBlock& block) = 0;
     virtual void Reset() = 0;
+
+    // Optionally set by AnalyzeInstruction, identifies what the check validates (ex. descriptor and access chain indexes).
+    // Two accesses with the same key in the same original block are validated by the first check only, the second access
+    // branches on the result of the first OpFunctionCall. Left empty when the check can't be shared.
+    std::vector<uint32_t> check_key_;
+
+  private:
+    uint32_t FindBlockCheck() const;
+
+    // Checks injected since the start of the block being instrumented, the result of the OpFunctionCall dominates all the
+    // blocks split from it
+    // < check key, OpFunctionCall result id >
+    std::vector<std::pair<std::vector<uint32_t>, uint32_t>> block_checks_;
 };
 
 }  // namespace spirv
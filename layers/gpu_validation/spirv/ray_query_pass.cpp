@@ -16,20 +16,25 @@
 #include "ray_query_pass.h"
 #include "module.h"
 #include <spirv/unified1/spirv.hpp>
+#include <cmath>
+#include <cstring>
 
 #include "generated/inst_ray_query_comp.h"
 
 namespace gpuav {
 namespace spirv {
 
-static LinkInfo link_info = {inst_ray_query_comp, inst_ray_query_comp_size, LinkFunctions::inst_ray_query, 0, "inst_ray_query"};
+static const LinkInfo link_info = {inst_ray_query_comp, inst_ray_query_comp_size, LinkFunctions::inst_ray_query, 0,
+                                   "inst_ray_query"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t RayQueryPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        // Shaders can be instrumented concurrently, only the module's copy is updated
+        LinkInfo module_link_info = link_info;
+        module_link_info.function_id = link_function_id;
+        module_.link_info_.push_back(module_link_info);
     }
     return link_function_id;
 }
@@ -59,13 +64,84 @@ uint32_t RayQueryPass::CreateFunctionCall(BasicBlock& block) {
 
 void RayQueryPass::Reset() { target_instruction_ = nullptr; }
 
+// When all the ray parameters are constants, run the same checks as inst_ray_query.comp when instrumenting,
+// a valid OpRayQueryInitializeKHR then doesn't need any runtime check
+bool RayQueryPass::IsStaticallyValid(const Instruction& inst) const {
+    const TypeManager& type_manager = module_.type_manager_;
+
+    // Returns false if not a 32-bit float OpConstant
+    auto get_float = [&type_manager](uint32_t id, float& value) {
+        const Constant* constant = type_manager.FindConstantById(id);
+        if (!constant || constant->inst_.Opcode() != spv::OpConstant || constant->type_.spv_type_ != SpvType::kFloat ||
+            constant->type_.inst_.Word(2) != 32) {
+            return false;
+        }
+        const uint32_t bits = constant->inst_.Word(3);
+        std::memcpy(&value, &bits, sizeof(float));
+        return true;
+    };
+    auto is_finite_vec3 = [&type_manager, &get_float](uint32_t id) {
+        const Constant* constant = type_manager.FindConstantById(id);
+        if (!constant || constant->inst_.Opcode() != spv::OpConstantComposite || constant->inst_.Length() != 6) {
+            return false;
+        }
+        for (uint32_t i = 0; i < 3; i++) {
+            float component = 0.0f;
+            if (!get_float(constant->inst_.Operand(i), component) || !std::isfinite(component)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    const Constant* ray_flags_constant = type_manager.FindConstantById(inst.Operand(2));
+    if (!ray_flags_constant || ray_flags_constant->inst_.Opcode() != spv::OpConstant) {
+        return false;
+    }
+    const uint32_t ray_flags = ray_flags_constant->inst_.Word(3);
+
+    float ray_tmin = 0.0f;
+    float ray_tmax = 0.0f;
+    if (!get_float(inst.Operand(5), ray_tmin) || !get_float(inst.Operand(7), ray_tmax)) {
+        return false;
+    }
+    if (std::isnan(ray_tmin) || std::isnan(ray_tmax) || ray_tmin < 0.0f || ray_tmax < 0.0f || ray_tmax < ray_tmin) {
+        return false;
+    }
+    if (!is_finite_vec3(inst.Operand(4)) || !is_finite_vec3(inst.Operand(6))) {
+        return false;
+    }
+
+    const uint32_t both_skip = spv::RayFlagsSkipTrianglesKHRMask | spv::RayFlagsSkipAABBsKHRMask;
+    const uint32_t skip_cull_mask = ray_flags & (spv::RayFlagsSkipTrianglesKHRMask | spv::RayFlagsCullBackFacingTrianglesKHRMask |
+                                                 spv::RayFlagsCullFrontFacingTrianglesKHRMask);
+    const uint32_t opaque_mask = ray_flags & (spv::RayFlagsOpaqueKHRMask | spv::RayFlagsNoOpaqueKHRMask |
+                                              spv::RayFlagsCullOpaqueKHRMask | spv::RayFlagsCullNoOpaqueKHRMask);
+    if ((ray_flags & both_skip) == both_skip) {
+        return false;
+    }
+    if (skip_cull_mask != 0 && (skip_cull_mask & (skip_cull_mask - 1)) != 0) {
+        return false;
+    }
+    if (opaque_mask != 0 && (opaque_mask & (opaque_mask - 1)) != 0) {
+        return false;
+    }
+    return true;
+}
+
 bool RayQueryPass::AnalyzeInstruction(const Function& function, const Instruction& inst) {
     (void)function;
     const uint32_t opcode = inst.Opcode();
     if (opcode != spv::OpRayQueryInitializeKHR) {
         return false;
     }
+    if (IsStaticallyValid(inst)) {
+        return false;
+    }
     target_instruction_ = &inst;
+
+    // Initializing with the same ray parameters gives the same result
+    check_key_ = {inst.Operand(2), inst.Operand(4), inst.Operand(5), inst.Operand(6), inst.Operand(7)};
     return true;
 }
 
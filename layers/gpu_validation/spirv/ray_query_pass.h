@@ -34,6 +34,8 @@ class RayQueryPass : public Pass {
     uint32_t CreateFunctionCall(BasicBlock& block) final;
     void Reset() final;
 
+    bool IsStaticallyValid(const Instruction& inst) const;
+
     uint32_t link_function_id = 0;
     uint32_t GetLinkFunctionId();
 
@@ -19,8 +19,12 @@
 #include "layer_options.h"
 #include "utils/hash_util.h"
 #include <vulkan/layer/vk_layer_settings.hpp>
+#include <limits>
+#include <sstream>
+#include <thread>
 
 #include "gpu_validation/gpu_settings.h"
+#include "sync/sync_settings.h"
 #include "error_message/logging.h"
 
 // Include new / delete overrides if using mimalloc. This needs to be include exactly once in a file that is
@@ -58,15 +62,20 @@ const char *VK_LAYER_OBJECT_LIFETIME = "object_lifetime";
 const char *VK_LAYER_CHECK_SHADERS = "check_shaders";
 const char *VK_LAYER_CHECK_SHADERS_CACHING = "check_shaders_caching";
 const char *VK_LAYER_VALIDATE_SYNC_QUEUE_SUBMIT = "sync_queue_submit";
+const char *VK_LAYER_SYNCVAL_USAGE_LOG_BUDGET = "syncval_usage_log_budget";
 
 const char *VK_LAYER_MESSAGE_ID_FILTER = "message_id_filter";
 const char *VK_LAYER_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *VK_LAYER_THREAD_POOL_SIZE = "thread_pool_size";
+const char *VK_LAYER_THREAD_POOL_STATS = "thread_pool_stats";
 
 const char *VK_LAYER_PRINTF_TO_STDOUT = "printf_to_stdout";
 const char *VK_LAYER_PRINTF_VERBOSE = "printf_verbose";
 const char *VK_LAYER_PRINTF_BUFFER_SIZE = "printf_buffer_size";
+const char *VK_LAYER_PRINTF_OUTPUT_FILE = "printf_output_file";
+const char *VK_LAYER_PRINTF_INVOCATION_FILTER = "printf_invocation_filter";
 
 // GPU-AV
 // ---
@@ -78,6 +87,8 @@ const char *VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS = "gpuav_max_buffer
 const char *VK_LAYER_GPUAV_VALIDATE_RAY_QUERY = "gpuav_validate_ray_query";
 const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
+const char *VK_LAYER_GPUAV_SHADER_PROFILE = "gpuav_shader_profile";
+const char *VK_LAYER_GPUAV_ERROR_DEDUPLICATION = "gpuav_error_deduplication";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_VALIDATE_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -420,6 +431,22 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING, *settings_data->fine_grained_locking);
     }
 
+    // Thread pool, 0 runs the tasks inline and -1 (read back as UINT32_MAX) picks a size from the number of cores (the thread
+    // waiting on tasks also runs them, hence the minus one)
+    constexpr uint32_t thread_pool_size_auto = std::numeric_limits<uint32_t>::max();
+    *settings_data->thread_pool_size = thread_pool_size_auto;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_POOL_SIZE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_POOL_SIZE, *settings_data->thread_pool_size);
+    }
+    if (*settings_data->thread_pool_size == thread_pool_size_auto) {
+        const uint32_t core_count = std::thread::hardware_concurrency();
+        *settings_data->thread_pool_size = core_count > 1 ? core_count - 1 : 0;
+    }
+    *settings_data->thread_pool_stats = false;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_THREAD_POOL_STATS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_THREAD_POOL_STATS, *settings_data->thread_pool_stats);
+    }
+
     // Message ID Filtering
     std::vector<std::string> message_id_filter;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_ID_FILTER)) {
@@ -454,6 +481,28 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_BUFFER_SIZE, printf_settings.buffer_size);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_OUTPUT_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_OUTPUT_FILE, printf_settings.output_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_INVOCATION_FILTER)) {
+        std::string invocation_filter;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_INVOCATION_FILTER, invocation_filter);
+        // "x,y" for a pixel, "x,y,z" for a compute or ray tracing invocation
+        std::istringstream filter_stream(invocation_filter);
+        std::string component;
+        while (std::getline(filter_stream, component, ',') && printf_settings.invocation_filter.size() < 3) {
+            try {
+                printf_settings.invocation_filter.emplace_back(static_cast<uint32_t>(std::stoul(component)));
+            } catch (...) {
+                printf("Validation Setting Warning - %s value \"%s\" is not a list of unsigned integers, it is ignored\n",
+                       VK_LAYER_PRINTF_INVOCATION_FILTER, invocation_filter.c_str());
+                printf_settings.invocation_filter.clear();
+                break;
+            }
+        }
+    }
+
     GpuAVSettings &gpuav_settings = *settings_data->gpuav_settings;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SHADER_INSTRUMENTATION)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SHADER_INSTRUMENTATION,
@@ -506,6 +555,14 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                    DEPRECATED_GPUAV_SELECT_INSTRUMENTED_SHADERS, VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS);
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SHADER_PROFILE)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SHADER_PROFILE, gpuav_settings.shader_profile);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_ERROR_DEDUPLICATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_ERROR_DEDUPLICATION, gpuav_settings.error_deduplication);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -541,6 +598,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         }
     }
 
+    SyncValSettings &syncval_settings = *settings_data->syncval_settings;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_USAGE_LOG_BUDGET)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_USAGE_LOG_BUDGET, syncval_settings.usage_log_budget_mb);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_RESERVE_BINDING_SLOT)) {
         SetValidationSetting(layer_setting_set, settings_data->enables, gpu_validation_reserve_binding_slot,
                              VK_LAYER_GPUAV_RESERVE_BINDING_SLOT);
@@ -90,6 +90,7 @@ using CHECK_ENABLED = std::array<bool, kMaxEnableFlags>;
 
 struct GpuAVSettings;
 struct DebugPrintfSettings;
+struct SyncValSettings;
 struct MessageFormatSettings;
 struct ConfigAndEnvSettings {
     const char *layer_description;
@@ -100,8 +101,11 @@ struct ConfigAndEnvSettings {
     uint32_t *duplicate_message_limit;
     MessageFormatSettings *message_format_settings;
     bool *fine_grained_locking;
+    uint32_t *thread_pool_size;
+    bool *thread_pool_stats;
     GpuAVSettings *gpuav_settings;
     DebugPrintfSettings *printf_settings;
+    SyncValSettings *syncval_settings;
 };
 
 static const vvl::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
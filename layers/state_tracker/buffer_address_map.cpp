@@ -0,0 +1,108 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "state_tracker/buffer_address_map.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+namespace vvl {
+
+BufferAddressSnapshot::BufferAddressSnapshot(const BufferAddressRangeMap &map) {
+    ranges_.reserve(map.size());
+    buffer_offsets_.reserve(map.size() + 1);
+    for (const auto &[range, buffers] : map) {
+        ranges_.emplace_back(range);
+        buffer_offsets_.emplace_back(static_cast<uint32_t>(buffers_.size()));
+        buffers_.insert(buffers_.end(), buffers.begin(), buffers.end());
+    }
+    buffer_offsets_.emplace_back(static_cast<uint32_t>(buffers_.size()));
+}
+
+vvl::span<vvl::Buffer *const> BufferAddressSnapshot::BuffersAt(size_t range_index) const {
+    const uint32_t first = buffer_offsets_[range_index];
+    return vvl::make_span<vvl::Buffer *const>(buffers_.data() + first, buffer_offsets_[range_index + 1] - first);
+}
+
+vvl::span<vvl::Buffer *const> BufferAddressSnapshot::Find(VkDeviceAddress address) const {
+    // First range ending after address, it is the only one that can contain it
+    const auto it = std::upper_bound(ranges_.begin(), ranges_.end(), address,
+                                     [](VkDeviceAddress value, const Range &range) { return value < range.end; });
+    if (it == ranges_.end() || address < it->begin) {
+        return vvl::make_span<vvl::Buffer *const>(nullptr, static_cast<size_t>(0));
+    }
+    return BuffersAt(static_cast<size_t>(std::distance(ranges_.begin(), it)));
+}
+
+void BufferAddressSnapshot::FindSorted(vvl::span<const VkDeviceAddress> addresses,
+                                       vvl::span<vvl::span<vvl::Buffer *const>> out) const {
+    assert(out.size() >= addresses.size());
+    auto range_it = ranges_.begin();
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        const VkDeviceAddress address = addresses[i];
+        assert(i == 0 || addresses[i - 1] <= address);
+        // Step over the ranges ending before address. Most of the time the next address is in the same or the next range,
+        // only fall back to a binary search of what is left when it is not.
+        if (range_it != ranges_.end() && range_it->end <= address) {
+            ++range_it;
+            if (range_it != ranges_.end() && range_it->end <= address) {
+                range_it = std::upper_bound(range_it, ranges_.end(), address,
+                                            [](VkDeviceAddress value, const Range &range) { return value < range.end; });
+            }
+        }
+        if (range_it == ranges_.end() || address < range_it->begin) {
+            out[i] = vvl::make_span<vvl::Buffer *const>(nullptr, static_cast<size_t>(0));
+        } else {
+            out[i] = BuffersAt(static_cast<size_t>(std::distance(ranges_.begin(), range_it)));
+        }
+    }
+}
+
+BufferAddressLookup BufferAddressMap::Find(VkDeviceAddress address) const {
+    auto snapshot = Read();
+    const auto buffers = snapshot->Find(address);
+    return BufferAddressLookup(std::move(snapshot), buffers);
+}
+
+BufferAddressBatchLookup BufferAddressMap::FindBatch(vvl::span<const VkDeviceAddress> addresses) const {
+    BufferAddressBatchLookup batch;
+    batch.snapshot_ = Read();
+    batch.results_.resize(addresses.size());
+
+    // Resolve in address order, then scatter the results back to the caller's order
+    std::vector<uint32_t> order(addresses.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&addresses](uint32_t a, uint32_t b) { return addresses[a] < addresses[b]; });
+    std::vector<VkDeviceAddress> sorted_addresses(addresses.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        sorted_addresses[i] = addresses[order[i]];
+    }
+    std::vector<vvl::span<vvl::Buffer *const>> sorted_results(addresses.size());
+    batch.snapshot_->FindSorted(sorted_addresses, sorted_results);
+    for (size_t i = 0; i < order.size(); ++i) {
+        batch.results_[order[i]] = sorted_results[i];
+    }
+    return batch;
+}
+
+void BufferAddressMap::Publish() {
+    std::atomic_store_explicit(&snapshot_, std::make_shared<const BufferAddressSnapshot>(map_), std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+}  // namespace vvl
@@ -0,0 +1,132 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <vulkan/vulkan.h>
+#include "containers/custom_containers.h"
+#include "containers/range_vector.h"
+
+namespace vvl {
+class Buffer;
+
+using BufferAddressMapStore = small_vector<vvl::Buffer *, 1, size_t>;
+using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+
+// Flat, immutable copy of a BufferAddressRangeMap.
+// The ranges of the map never overlap (buffers with overlapping addresses share the list of the overlapped range), so sorting
+// them by start address also sorts them by end address, and a point query is a single binary search.
+// The buffer lists are stored back to back in one array, indexed by buffer_offsets_.
+class BufferAddressSnapshot {
+  public:
+    using Range = sparse_container::range<VkDeviceAddress>;
+
+    BufferAddressSnapshot() = default;
+    explicit BufferAddressSnapshot(const BufferAddressRangeMap &map);
+
+    vvl::span<vvl::Buffer *const> Find(VkDeviceAddress address) const;
+    // addresses must be sorted in ascending order, and out must be as large as addresses.
+    // All addresses are resolved in one pass, the search for the next address starting where the previous one ended.
+    void FindSorted(vvl::span<const VkDeviceAddress> addresses, vvl::span<vvl::span<vvl::Buffer *const>> out) const;
+
+    const std::vector<Range> &Ranges() const { return ranges_; }
+
+  private:
+    vvl::span<vvl::Buffer *const> BuffersAt(size_t range_index) const;
+
+    std::vector<Range> ranges_;
+    // ranges_.size() + 1 entries, buffers of ranges_[i] are buffers_[buffer_offsets_[i], buffer_offsets_[i + 1])
+    std::vector<uint32_t> buffer_offsets_;
+    std::vector<vvl::Buffer *> buffers_;
+};
+
+// Buffers found at one address. Keeps the snapshot they are listed in alive, so the result is not invalidated when a newer
+// snapshot is published. Converts to the vvl::span used by the buffer address validation helpers.
+class BufferAddressLookup {
+  public:
+    BufferAddressLookup() = default;
+    BufferAddressLookup(std::shared_ptr<const BufferAddressSnapshot> &&snapshot, vvl::span<vvl::Buffer *const> buffers)
+        : snapshot_(std::move(snapshot)), buffers_(buffers) {}
+
+    vvl::Buffer *const *begin() const { return buffers_.begin(); }
+    vvl::Buffer *const *end() const { return buffers_.end(); }
+    vvl::Buffer *operator[](size_t i) const { return buffers_[i]; }
+    size_t size() const { return buffers_.size(); }
+    bool empty() const { return buffers_.empty(); }
+
+    operator const vvl::span<vvl::Buffer *const> &() const { return buffers_; }
+
+  private:
+    std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+    vvl::span<vvl::Buffer *const> buffers_;
+};
+
+// Buffers found for a batch of addresses, in the order the addresses were given
+class BufferAddressBatchLookup {
+  public:
+    size_t size() const { return results_.size(); }
+    const vvl::span<vvl::Buffer *const> &operator[](size_t i) const { return results_[i]; }
+
+  private:
+    friend class BufferAddressMap;
+    std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+    std::vector<vvl::span<vvl::Buffer *const>> results_;
+};
+
+// Device address -> buffers map.
+// Writers (vkGetBufferDeviceAddress, vkDestroyBuffer...) are rare: they modify the range map under a lock, then publish a new
+// snapshot of it. Readers (every validation of a device address) only load the current snapshot and never take a lock.
+class BufferAddressMap {
+  public:
+    BufferAddressMap() : snapshot_(std::make_shared<const BufferAddressSnapshot>()) {}
+
+    std::shared_ptr<const BufferAddressSnapshot> Read() const {
+        return std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+    }
+    // Incremented each time a new snapshot is published
+    uint32_t Version() const { return version_.load(std::memory_order_acquire); }
+
+    // func modifies the range map, returns true if it changed it and a new snapshot must be published
+    template <typename Func>
+    void Update(Func &&func) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        if (func(map_)) {
+            Publish();
+        }
+    }
+
+    BufferAddressLookup Find(VkDeviceAddress address) const;
+    // addresses can be in any order, they are sorted internally to be resolved in a single pass
+    BufferAddressBatchLookup FindBatch(vvl::span<const VkDeviceAddress> addresses) const;
+
+  private:
+    // Caller must hold write_lock_
+    void Publish();
+
+    // Only accessed by writers
+    BufferAddressRangeMap map_;
+    std::mutex write_lock_;
+
+    std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+    std::atomic<uint32_t> version_{0};
+};
+
+}  // namespace vvl
@@ -1055,6 +1055,11 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
 void CommandBuffer::End(VkResult result) {
     if (VK_SUCCESS == result) {
         state = CbState::Recorded;
+        for (auto &layout_map_entry : image_layout_map) {
+            if (layout_map_entry.second.map) {
+                layout_map_entry.second.map->BuildSummary();
+            }
+        }
     }
 }
 
@@ -1072,6 +1077,9 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
         }
 
         // Propagate inital layout and current layout state to the primary cmd buffer
+        // Unlike the event and submit time updates below, this merge (like the QFO transfer barriers and the sync validation
+        // access contexts merged by the derived classes) has to happen at record time: the commands recorded in the primary
+        // after vkCmdExecuteCommands are validated against it. UpdateFrom() splices every range of the secondary's map.
         // NOTE: The update/population of the image_layout_map is done in CoreChecks, but for other classes derived from
         // ValidationStateTracker these maps will be empty, so leaving the propagation in the the state tracker should be a no-op
         // for those other classes.
@@ -1102,14 +1110,37 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
             }
             return skip;
         });
-        for (auto &function : sub_cb_state->eventUpdates) {
-            eventUpdates.push_back(function);
+        // Event updates and submit time functions are also run from the secondary when the primary is submitted, rather than
+        // copied into the primary here. Re-recording or freeing the secondary invalidates the primary, so the lists read at
+        // submit time are the ones recorded when vkCmdExecuteCommands was called.
+        // The event updates get the secondary, they index the events vector of the command buffer which recorded them.
+        if (!sub_cb_state->eventUpdates.empty()) {
+            eventUpdates.emplace_back([sub_command_buffer](CommandBuffer &cb_state_arg, bool do_validate,
+                                                           EventMap &local_event_signal_info, VkQueue waiting_queue,
+                                                           const Location &loc) {
+                bool skip = false;
+                auto sub_cb_state_arg = cb_state_arg.dev_data.GetWrite<CommandBuffer>(sub_command_buffer);
+                if (!sub_cb_state_arg) return skip;
+                for (auto &function : sub_cb_state_arg->eventUpdates) {
+                    skip |= function(*sub_cb_state_arg, do_validate, local_event_signal_info, waiting_queue, loc);
+                }
+                return skip;
+            });
         }
         for (auto &event : sub_cb_state->events) {
             events.push_back(event);
         }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            queue_submit_functions.push_back(function);
+        if (!sub_cb_state->queue_submit_functions.empty()) {
+            queue_submit_functions.emplace_back([sub_command_buffer](const ValidationStateTracker &device_data,
+                                                                     const vvl::Queue &queue_state, const CommandBuffer &cb_state) {
+                bool skip = false;
+                auto sub_cb_state_arg = device_data.Get<CommandBuffer>(sub_command_buffer);
+                if (!sub_cb_state_arg) return skip;
+                for (auto &function : sub_cb_state_arg->queue_submit_functions) {
+                    skip |= function(device_data, queue_state, cb_state);
+                }
+                return skip;
+            });
         }
 
         // State is trashed after executing secondary command buffers.
@@ -158,7 +158,7 @@ class CommandBuffer : public RefcountedStateObject {
         std::shared_ptr<ImageSubresourceLayoutMap> map;
     };
     using ImageLayoutMap = vvl::unordered_map<VkImage, LayoutState>;
-    using AliasedLayoutMap = vvl::unordered_map<const GlobalImageLayoutRangeMap *, std::shared_ptr<ImageSubresourceLayoutMap>>;
+    using AliasedLayoutMap = vvl::unordered_map<const GlobalImageLayoutStore *, std::shared_ptr<ImageSubresourceLayoutMap>>;
 
     VkCommandBufferAllocateInfo allocate_info;
     VkCommandBufferBeginInfo beginInfo;
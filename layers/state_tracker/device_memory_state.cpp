@@ -17,7 +17,7 @@
  * limitations under the License.
  */
 #include "state_tracker/device_memory_state.h"
-#include "state_tracker/image_state.h"
+#include <vulkan/utility/vk_struct_helper.hpp>
 
 using MemoryRange = vvl::BindableMemoryTracker::MemoryRange;
 using BoundMemoryRange = vvl::BindableMemoryTracker::BoundMemoryRange;
@@ -126,9 +126,29 @@ BoundMemoryRange vvl::BindableLinearMemoryTracker::GetBoundMemoryRange(const Mem
                                  : BoundMemoryRange{};
 }
 
+vvl::BindableSparseMemoryTracker::BindableSparseMemoryTracker(const VkMemoryRequirements *requirements, bool is_resident)
+    : resource_size_(requirements->size),
+      page_size_(requirements->alignment),
+      page_count_(page_size_ != 0 ? (resource_size_ + page_size_ - 1) / page_size_ : 0),
+      is_resident_(is_resident) {
+    if (page_size_ == 0) {
+        use_binding_map_ = true;
+    } else {
+        page_blocks_.resize(static_cast<size_t>((page_count_ + kPagesPerBlock - 1) >> kPagesPerBlockLog2));
+    }
+}
+
 unsigned vvl::BindableSparseMemoryTracker::CountDeviceMemory(VkDeviceMemory memory) const {
     unsigned count = 0u;
     auto guard = ReadLockGuard{binding_lock_};
+    if (!use_binding_map_) {
+        for (const auto &[memory_ptr, reference] : page_memories_) {
+            if (reference.memory_state->VkHandle() == memory) {
+                count += static_cast<unsigned>(reference.page_count);
+            }
+        }
+        return count;
+    }
     for (const auto &range_state : binding_map_) {
         count += (range_state.second.memory_state && range_state.second.memory_state->VkHandle() == memory);
     }
@@ -137,15 +157,25 @@ unsigned vvl::BindableSparseMemoryTracker::CountDeviceMemory(VkDeviceMemory memo
 
 bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
     if (!is_resident_) {
-        VkDeviceSize current_offset = 0u;
-        {
-            auto guard = ReadLockGuard{binding_lock_};
-            for (const auto &range : binding_map_) {
-                if (current_offset != range.first.begin || !range.second.memory_state || range.second.memory_state->Invalid()) {
+        auto guard = ReadLockGuard{binding_lock_};
+        if (!use_binding_map_) {
+            if (bound_page_count_ != page_count_) {
+                return false;
+            }
+            for (const auto &[memory_ptr, reference] : page_memories_) {
+                if (reference.memory_state->Invalid()) {
                     return false;
                 }
-                current_offset = range.first.end;
             }
+            return true;
+        }
+
+        VkDeviceSize current_offset = 0u;
+        for (const auto &range : binding_map_) {
+            if (current_offset != range.first.begin || !range.second.memory_state || range.second.memory_state->Invalid()) {
+                return false;
+            }
+            current_offset = range.first.end;
         }
 
         if (current_offset != resource_size_) return false;
@@ -154,13 +184,119 @@ bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
     return true;
 }
 
+bool vvl::BindableSparseMemoryTracker::IsPageAligned(VkDeviceSize resource_offset, VkDeviceSize size) const {
+    if (size == 0 || resource_offset >= resource_size_ || size > resource_size_ - resource_offset) {
+        return false;
+    }
+    // The last bind of a resource can end on a partial page
+    return (resource_offset % page_size_) == 0 && ((size % page_size_) == 0 || resource_offset + size == resource_size_);
+}
+
+void vvl::BindableSparseMemoryTracker::UnbindPage(StateObject *parent, PageBlock &block, Page &page) {
+    if (!page.memory) {
+        return;
+    }
+    auto reference_it = page_memories_.find(page.memory);
+    assert(reference_it != page_memories_.end());
+    if (--reference_it->second.page_count == 0) {
+        reference_it->second.memory_state->RemoveParent(parent);
+        page_memories_.erase(reference_it);
+    }
+    page = Page{};
+    --block.bound_count;
+    --bound_page_count_;
+}
+
+void vvl::BindableSparseMemoryTracker::BindPages(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
+                                                 VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
+    const uint64_t first_page = resource_offset / page_size_;
+    const uint64_t end_page = (resource_offset + size + page_size_ - 1) / page_size_;
+    // A null memory unbinds the pages
+    vvl::DeviceMemory *memory = (mem_state && mem_state->VkHandle() != VK_NULL_HANDLE) ? mem_state.get() : nullptr;
+
+    for (uint64_t page_index = first_page; page_index < end_page; ++page_index) {
+        auto &block = page_blocks_[static_cast<size_t>(page_index >> kPagesPerBlockLog2)];
+        if (!block) {
+            if (!memory) {
+                // Whole block is already unbound
+                page_index |= kPagesPerBlock - 1;
+                continue;
+            }
+            block = std::make_unique<PageBlock>();
+        }
+        Page &page = block->pages[page_index & (kPagesPerBlock - 1)];
+        UnbindPage(parent, *block, page);
+        if (memory) {
+            page.memory = memory;
+            page.memory_offset = memory_offset + (PageBegin(page_index) - resource_offset);
+            ++block->bound_count;
+            ++bound_page_count_;
+        } else if (block->bound_count == 0) {
+            block.reset();
+            page_index |= kPagesPerBlock - 1;
+        }
+    }
+
+    if (memory) {
+        // Counted once for the whole bind instead of once per page
+        MemoryReference &reference = page_memories_[memory];
+        if (reference.page_count == 0) {
+            reference.memory_state = mem_state;
+            mem_state->AddParent(parent);
+        }
+        reference.page_count += end_page - first_page;
+    }
+}
+
+void vvl::BindableSparseMemoryTracker::MoveToBindingMap() {
+    // Pages are merged back into ranges where both the resource and memory ranges are contiguous
+    BindingMap::key_type pending_range;
+    MEM_BINDING pending_binding{};
+    auto flush_pending = [this, &pending_range, &pending_binding]() {
+        if (pending_binding.memory_state) {
+            binding_map_.insert(binding_map_.end(), std::make_pair(pending_range, std::move(pending_binding)));
+            pending_binding = MEM_BINDING{};
+        }
+    };
+    for (uint64_t page_index = 0; page_index < page_count_; ++page_index) {
+        const auto &block = page_blocks_[static_cast<size_t>(page_index >> kPagesPerBlockLog2)];
+        const Page *page = block ? &block->pages[page_index & (kPagesPerBlock - 1)] : nullptr;
+        if (!page || !page->memory) {
+            flush_pending();
+            continue;
+        }
+        if (pending_binding.memory_state.get() == page->memory && pending_range.end == PageBegin(page_index) &&
+            pending_binding.memory_offset + pending_range.distance() == page->memory_offset) {
+            pending_range.end = PageEnd(page_index);
+            continue;
+        }
+        flush_pending();
+        pending_range = BindingMap::key_type(PageBegin(page_index), PageEnd(page_index));
+        pending_binding = MEM_BINDING{page_memories_.at(page->memory).memory_state, page->memory_offset, PageBegin(page_index)};
+    }
+    flush_pending();
+    page_blocks_.clear();
+    page_memories_.clear();
+    bound_page_count_ = 0;
+    use_binding_map_ = true;
+}
+
 void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
+    auto guard = WriteLockGuard{binding_lock_};
+
+    if (!use_binding_map_) {
+        if (IsPageAligned(resource_offset, size)) {
+            BindPages(parent, mem_state, memory_offset, resource_offset, size);
+            return;
+        }
+        // The parent links are the same in both representations, nothing to update
+        MoveToBindingMap();
+    }
+
     MEM_BINDING memory_data{mem_state, memory_offset, resource_offset};
     BindingMap::value_type item{{resource_offset, resource_offset + size}, memory_data};
 
-    auto guard = WriteLockGuard{binding_lock_};
-
     // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
     for (auto &value_pair : binding_map_) {
         if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
@@ -175,16 +311,48 @@ void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shar
 BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const MemoryRange &range) const {
     BoundMemoryRange mem_ranges;
     auto guard = ReadLockGuard{binding_lock_};
+
+    if (!use_binding_map_) {
+        if (range.begin >= range.end || range.begin >= resource_size_) {
+            return mem_ranges;
+        }
+        const uint64_t end_page = (std::min(range.end, resource_size_) + page_size_ - 1) / page_size_;
+        for (uint64_t page_index = range.begin / page_size_; page_index < end_page; ++page_index) {
+            const auto &block = page_blocks_[static_cast<size_t>(page_index >> kPagesPerBlockLog2)];
+            if (!block) {
+                page_index |= kPagesPerBlock - 1;
+                continue;
+            }
+            const Page &page = block->pages[page_index & (kPagesPerBlock - 1)];
+            if (!page.memory) {
+                continue;
+            }
+            const VkDeviceSize resource_begin = std::max(range.begin, PageBegin(page_index));
+            const VkDeviceSize resource_end = std::min(range.end, PageEnd(page_index));
+            const VkDeviceSize memory_range_start = page.memory_offset + (resource_begin - PageBegin(page_index));
+            const VkDeviceSize memory_range_end = memory_range_start + (resource_end - resource_begin);
+
+            auto &memory_ranges = mem_ranges[page.memory->VkHandle()];
+            if (!memory_ranges.empty() && memory_ranges.back().end == memory_range_start) {
+                memory_ranges.back().end = memory_range_end;
+            } else {
+                memory_ranges.emplace_back(memory_range_start, memory_range_end);
+            }
+        }
+        return mem_ranges;
+    }
+
     auto range_bounds = binding_map_.bounds(range);
 
     for (auto it = range_bounds.begin; it != range_bounds.end; ++it) {
         const auto &[resource_range, memory_data] = *it;
         if (memory_data.memory_state && memory_data.memory_state->VkHandle() != VK_NULL_HANDLE) {
-            const VkDeviceSize memory_range_start = std::max(range.begin, memory_data.resource_offset) -
+            // resource_range can be a piece of the original binding left by a later overlapping bind, so clamp to it rather
+            // than to the original binding resource range
+            const VkDeviceSize memory_range_start = std::max(range.begin, resource_range.begin) -
                 memory_data.resource_offset + memory_data.memory_offset;
             const VkDeviceSize memory_range_end =
-                std::min(range.end, memory_data.resource_offset + resource_range.distance()) - memory_data.resource_offset +
-                memory_data.memory_offset;
+                std::min(range.end, resource_range.end) - memory_data.resource_offset + memory_data.memory_offset;
 
             mem_ranges[memory_data.memory_state->VkHandle()].emplace_back(memory_range_start, memory_range_end);
         }
@@ -197,6 +365,9 @@ DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStates() const
 
     {
         auto guard = ReadLockGuard{binding_lock_};
+        for (const auto &[memory_ptr, reference] : page_memories_) {
+            dev_mem_states.emplace(reference.memory_state);
+        }
         for (auto &binding : binding_map_) {
             if (binding.second.memory_state) dev_mem_states.emplace(binding.second.memory_state);
         }
@@ -20,6 +20,8 @@
 #include "state_tracker/state_object.h"
 #include "containers/range_vector.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <algorithm>
+#include <array>
 
 namespace vvl {
 struct MemRange {
@@ -157,10 +159,15 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
 
 // Sparse bindable memory tracker
 // Does not contemplate the idea of multiplanar sparse images
+//
+// Sparse resources are bound page by page (a page being VkMemoryRequirements::alignment bytes), often thousands of pages per
+// frame, so bindings are kept in a two level page table: binding or unbinding a page is O(1) and a count of bound pages answers
+// HasFullRangeBound() without walking the bindings.
+// A binding that is not page aligned (ex. invalid usage, or the approximated offsets of image binds) moves the tracker to a
+// range map, which handles any range, for the rest of the resource lifetime.
 class BindableSparseMemoryTracker : public BindableMemoryTracker {
   public:
-    BindableSparseMemoryTracker(const VkMemoryRequirements *requirements, bool is_resident)
-        : resource_size_(requirements->size), is_resident_(is_resident) {}
+    BindableSparseMemoryTracker(const VkMemoryRequirements *requirements, bool is_resident);
 
     const MEM_BINDING *Binding() const override { return nullptr; }
 
@@ -176,11 +183,45 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
     DeviceMemoryState GetBoundMemoryStates() const override;
 
   private:
+    struct Page {
+        vvl::DeviceMemory *memory = nullptr;
+        VkDeviceSize memory_offset = 0;
+    };
+    static constexpr uint32_t kPagesPerBlockLog2 = 9;
+    static constexpr uint32_t kPagesPerBlock = 1u << kPagesPerBlockLog2;
+    // Blocks are allocated on first bind, and freed when their last page is unbound
+    struct PageBlock {
+        std::array<Page, kPagesPerBlock> pages;
+        uint32_t bound_count = 0;
+    };
+    // Keeps the bound memories alive, and counts the pages bound to each of them to maintain the parent links
+    struct MemoryReference {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        uint64_t page_count = 0;
+    };
+
+    bool IsPageAligned(VkDeviceSize resource_offset, VkDeviceSize size) const;
+    VkDeviceSize PageBegin(uint64_t page) const { return page * page_size_; }
+    VkDeviceSize PageEnd(uint64_t page) const { return std::min(resource_size_, (page + 1) * page_size_); }
+    // Caller must hold binding_lock_ for writing
+    void BindPages(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
+                   VkDeviceSize resource_offset, VkDeviceSize size);
+    void UnbindPage(StateObject *parent, PageBlock &block, Page &page);
+    void MoveToBindingMap();
+
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
     BindingMap binding_map_;
+    bool use_binding_map_ = false;
+
+    std::vector<std::unique_ptr<PageBlock>> page_blocks_;
+    vvl::unordered_map<const vvl::DeviceMemory *, MemoryReference> page_memories_;
+    uint64_t bound_page_count_ = 0;
+
     mutable std::shared_mutex binding_lock_;
     VkDeviceSize resource_size_;
+    VkDeviceSize page_size_;
+    uint64_t page_count_;
     bool is_resident_;
 };
 
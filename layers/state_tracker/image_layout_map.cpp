@@ -113,6 +113,7 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const vvl::CommandBuff
         expected_layout = layout;
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
+    summary_ = Summary();
 
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
@@ -140,6 +141,7 @@ static void SetSubresourceRangeInitialLayoutImpl(LayoutMap& layouts, InitialLayo
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state,
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
+    summary_ = Summary();
 
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
@@ -153,6 +155,7 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, VkImageLayout layout,
                                                                  const vvl::ImageView& view_state) {
+    summary_ = Summary();
     RangeGenerator range_gen(view_state.range_generator);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -173,6 +176,7 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     // Must be from matching images for the reinterpret cast to be valid
     assert(CompatibilityKey() == other.CompatibilityKey());
     if (CompatibilityKey() != other.CompatibilityKey()) return false;
+    summary_ = Summary();
 
     // NOTE -- we are copying plain state pointers from 'other' which owns them in a vector.  This works because
     //         currently this function is only used to import from secondary command buffers, destruction of which
@@ -181,4 +185,16 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     return sparse_container::splice(layouts_, other.layouts_, LayoutEntry::Updater());
 }
 
+void ImageSubresourceLayoutMap::BuildSummary() {
+    summary_ = Summary();
+    if (layouts_.size() != 1) return;
+
+    const auto& entry = *layouts_.begin();
+    if (entry.first.begin == 0 && entry.first.end == encoder_.SubresourceCount()) {
+        summary_.whole_image = true;
+        summary_.initial_layout = entry.second.initial_layout;
+        summary_.current_layout = entry.second.current_layout;
+    }
+}
+
 }  // namespace image_layout_map
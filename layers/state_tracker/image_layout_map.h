@@ -20,8 +20,10 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "containers/range_vector.h"
@@ -114,6 +116,14 @@ class ImageSubresourceLayoutMap {
     using LayoutMap = subresource_adapter::BothRangeMap<LayoutEntry, 16>;
     using RangeType = LayoutMap::key_type;
 
+    // Built at vkEndCommandBuffer. The common case of a command buffer using every subresource of an image with a single
+    // initial and a single final layout is then validated and applied at submit time without walking the layout map.
+    struct Summary {
+        bool whole_image = false;
+        VkImageLayout initial_layout = kInvalidLayout;
+        VkImageLayout current_layout = kInvalidLayout;
+    };
+
     bool SetSubresourceRangeLayout(const vvl::CommandBuffer& cb_state, const VkImageSubresourceRange& range, VkImageLayout layout,
                                    VkImageLayout expected_layout = kInvalidLayout);
     void SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, const VkImageSubresourceRange& range,
@@ -123,6 +133,8 @@ class ImageSubresourceLayoutMap {
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
     const LayoutMap& GetLayoutMap() const { return layouts_; }
+    void BuildSummary();
+    const Summary& GetSummary() const { return summary_; }
     ImageSubresourceLayoutMap(const vvl::Image& image_state);
     ~ImageSubresourceLayoutMap() {}
     const vvl::Image* GetImageView() const { return &image_state_; };
@@ -170,6 +182,7 @@ class ImageSubresourceLayoutMap {
     const Encoder& encoder_;
     LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+    Summary summary_;
 };
 }  // namespace image_layout_map
 
@@ -179,11 +192,44 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
     using RangeType = key_type;
 
     GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
-    ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
-    WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
     bool AnyInRange(RangeGenerator& gen, std::function<bool(const key_type& range, const mapped_type& state)>&& func) const;
+};
+
+// The layout state of an image outside of any command buffer, shared by all the images aliasing the same memory.
+// Every version of the layouts is immutable once published. Readers grab the current version with an atomic load of the
+// shared_ptr, which is not lock-free (libstdc++ and MSVC guard it with a small spinlock), but readers never wait on a writer
+// building a version. Each Update copies the whole map, so this only pays off for images whose layouts are read far more
+// often than written.
+class GlobalImageLayoutStore {
+  public:
+    using Snapshot = std::shared_ptr<const GlobalImageLayoutRangeMap>;
+    using index_type = GlobalImageLayoutRangeMap::index_type;
+
+    GlobalImageLayoutStore(index_type subresource_count, VkImageLayout initial_layout);
+
+    Snapshot Read() const { return std::atomic_load_explicit(&current_, std::memory_order_acquire); }
+
+    // Set every subresource to the same layout, no copy of the previous version is needed
+    void SetAll(VkImageLayout layout);
+
+    // func gets a copy of the current version to modify, returns true if the copy must be published
+    template <typename Func>
+    void Update(Func&& func) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        auto next = Copy(*current_);
+        if (func(*next)) {
+            Publish(std::move(next));
+        }
+    }
 
   private:
-    mutable std::shared_mutex lock_;
+    std::shared_ptr<GlobalImageLayoutRangeMap> Copy(const GlobalImageLayoutRangeMap& from) const;
+    // Caller must hold write_lock_
+    void Publish(std::shared_ptr<const GlobalImageLayoutRangeMap>&& next);
+
+    const index_type subresource_count_;
+    std::shared_ptr<const GlobalImageLayoutRangeMap> current_;
+    // Only serializes writers between themselves
+    std::mutex write_lock_;
 };
\ No newline at end of file
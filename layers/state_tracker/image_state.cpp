@@ -326,7 +326,7 @@ void Image::SetInitialLayoutMap() {
         return;
     }
 
-    std::shared_ptr<GlobalImageLayoutRangeMap> layout_map;
+    std::shared_ptr<GlobalImageLayoutStore> layout_map;
     auto get_layout_map = [&layout_map](const Image &other_image) {
         layout_map = other_image.layout_range_map;
         return true;
@@ -343,12 +343,7 @@ void Image::SetInitialLayoutMap() {
 
     if (!layout_map) {
         // otherwise set up a new map.
-        // set up the new map completely before making it available
-        layout_map = std::make_shared<GlobalImageLayoutRangeMap>(subresource_encoder.SubresourceCount());
-        auto range_gen = subresource_adapter::RangeGenerator(subresource_encoder);
-        for (; range_gen->non_empty(); ++range_gen) {
-            layout_map->insert(layout_map->end(), std::make_pair(*range_gen, create_info.initialLayout));
-        }
+        layout_map = std::make_shared<GlobalImageLayoutStore>(subresource_encoder.SubresourceCount(), create_info.initialLayout);
     }
     // And store in the object
     layout_range_map = std::move(layout_map);
@@ -358,10 +353,12 @@ void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout l
     using sparse_container::update_range_value;
     using sparse_container::value_precedence;
     GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, NormalizeSubresourceRange(range));
-    auto guard = layout_range_map->WriteLock();
-    for (; range_gen->non_empty(); ++range_gen) {
-        update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
-    }
+    layout_range_map->Update([&range_gen, layout](GlobalImageLayoutRangeMap &layout_map) {
+        for (; range_gen->non_empty(); ++range_gen) {
+            update_range_value(layout_map, *range_gen, layout, value_precedence::prefer_source);
+        }
+        return true;
+    });
 }
 
 void Image::SetSwapchain(std::shared_ptr<vvl::Swapchain> &swapchain, uint32_t swapchain_index) {
@@ -887,3 +884,29 @@ bool GlobalImageLayoutRangeMap::AnyInRange(RangeGenerator &gen,
     }
     return false;
 }
+
+GlobalImageLayoutStore::GlobalImageLayoutStore(index_type subresource_count, VkImageLayout initial_layout)
+    : subresource_count_(subresource_count) {
+    auto initial = std::make_shared<GlobalImageLayoutRangeMap>(subresource_count_);
+    initial->insert(initial->end(), std::make_pair(GlobalImageLayoutRangeMap::RangeType(0, subresource_count_), initial_layout));
+    current_ = std::move(initial);
+}
+
+void GlobalImageLayoutStore::SetAll(VkImageLayout layout) {
+    auto next = std::make_shared<GlobalImageLayoutRangeMap>(subresource_count_);
+    next->insert(next->end(), std::make_pair(GlobalImageLayoutRangeMap::RangeType(0, subresource_count_), layout));
+    std::lock_guard<std::mutex> guard(write_lock_);
+    Publish(std::move(next));
+}
+
+std::shared_ptr<GlobalImageLayoutRangeMap> GlobalImageLayoutStore::Copy(const GlobalImageLayoutRangeMap &from) const {
+    auto copy = std::make_shared<GlobalImageLayoutRangeMap>(subresource_count_);
+    for (const auto &entry : from) {
+        copy->insert(copy->end(), entry);
+    }
+    return copy;
+}
+
+void GlobalImageLayoutStore::Publish(std::shared_ptr<const GlobalImageLayoutRangeMap> &&next) {
+    std::atomic_store_explicit(&current_, std::move(next), std::memory_order_release);
+}
@@ -122,7 +122,7 @@ class Image : public Bindable {
     std::unique_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
     const VkDevice store_device_as_workaround;                                       // TODO REMOVE WHEN encoder can be const
 
-    std::shared_ptr<GlobalImageLayoutRangeMap> layout_range_map;
+    std::shared_ptr<GlobalImageLayoutStore> layout_range_map;
 
     vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>> supported_video_profiles;
 
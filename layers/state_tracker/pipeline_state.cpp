@@ -370,6 +370,94 @@ static CBDynamicFlags GetGraphicsDynamicState(Pipeline &pipe_state) {
     return flags;
 }
 
+static CBDynamicFlags GetDrawRequiredDynamicState(const Pipeline &pipe_state) {
+    if (pipe_state.dynamic_state.none()) {
+        return pipe_state.dynamic_state;
+    }
+    // Dynamic states that always need to be set when dynamic
+    static const CBDynamicFlags always_required = []() {
+        CBDynamicFlags flags = 0;
+        for (const CBDynamicState state : {
+                 // VK_EXT_extended_dynamic_state
+                 CB_DYNAMIC_STATE_CULL_MODE,
+                 CB_DYNAMIC_STATE_FRONT_FACE,
+                 CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY,
+                 CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE,
+                 CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE,
+                 CB_DYNAMIC_STATE_DEPTH_COMPARE_OP,
+                 CB_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE,
+                 CB_DYNAMIC_STATE_STENCIL_TEST_ENABLE,
+                 CB_DYNAMIC_STATE_STENCIL_OP,
+                 // VK_EXT_extended_dynamic_state2
+                 CB_DYNAMIC_STATE_PATCH_CONTROL_POINTS_EXT,
+                 CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE,
+                 CB_DYNAMIC_STATE_DEPTH_BIAS_ENABLE,
+                 CB_DYNAMIC_STATE_LOGIC_OP_EXT,
+                 CB_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE,
+                 // VK_EXT_extended_dynamic_state3
+                 CB_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_POLYGON_MODE_EXT,
+                 CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT,
+                 CB_DYNAMIC_STATE_SAMPLE_MASK_EXT,
+                 CB_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT,
+                 CB_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT,
+                 CB_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT,
+                 CB_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT,
+                 CB_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT,
+                 CB_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT,
+                 CB_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT,
+                 CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV,
+                 CB_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV,
+                 CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV,
+                 CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV,
+                 CB_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV,
+                 CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV,
+                 CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV,
+                 CB_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV,
+                 CB_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV,
+                 CB_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV,
+                 CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT,
+                 CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_ENABLE_NV,
+                 CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_NV,
+                 // VK_EXT_discard_rectangles
+                 CB_DYNAMIC_STATE_DISCARD_RECTANGLE_ENABLE_EXT,
+                 CB_DYNAMIC_STATE_DISCARD_RECTANGLE_MODE_EXT,
+                 // VK_EXT_vertex_input_dynamic_state
+                 CB_DYNAMIC_STATE_VERTEX_INPUT_EXT,
+                 // VK_EXT_color_write_enable
+                 CB_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT,
+                 // VK_EXT_attachment_feedback_loop_dynamic_state
+                 CB_DYNAMIC_STATE_ATTACHMENT_FEEDBACK_LOOP_ENABLE_EXT,
+             }) {
+            flags.set(state);
+        }
+        return flags;
+    }();
+
+    CBDynamicFlags flags = pipe_state.dynamic_state & always_required;
+
+    // Required depending on other pipeline state only
+    if (!pipe_state.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT) &&
+        pipe_state.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT)) {
+        flags.set(CB_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE);
+    }
+    if (const auto *raster_state = pipe_state.RasterizationState()) {
+        if (raster_state->depthBiasEnable == VK_TRUE && pipe_state.IsDynamic(VK_DYNAMIC_STATE_DEPTH_BIAS)) {
+            flags.set(CB_DYNAMIC_STATE_DEPTH_BIAS);
+        }
+    }
+    if (pipe_state.BlendConstantsEnabled() && pipe_state.IsDynamic(VK_DYNAMIC_STATE_BLEND_CONSTANTS)) {
+        flags.set(CB_DYNAMIC_STATE_BLEND_CONSTANTS);
+    }
+    return flags;
+}
+
 static CBDynamicFlags GetRayTracingDynamicState(Pipeline &pipe_state) {
     CBDynamicFlags flags = 0;
 
@@ -705,6 +793,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPip
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(GetGraphicsDynamicState(*this)),
+      draw_required_dynamic_state(GetDrawRequiredDynamicState(*this)),
       topology_at_rasterizer(GetTopologyAtRasterizer(*this)),
       descriptor_buffer_mode((create_flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(GraphicsCreateInfo().pNext, *this)),
@@ -750,6 +839,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkComputePipe
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(0),  // compute has no dynamic state
+      draw_required_dynamic_state(0),
       descriptor_buffer_mode((create_flags & VK_PIPELINE_CREATE_2_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(ComputeCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(false),
@@ -774,6 +864,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkRayTracingP
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(GetRayTracingDynamicState(*this)),
+      draw_required_dynamic_state(0),
       descriptor_buffer_mode((RayTracingCreateInfo().flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(RayTracingCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(false),
@@ -798,6 +889,7 @@ Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkRayTracingP
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
       dynamic_state(GetRayTracingDynamicState(*this)),
+      draw_required_dynamic_state(0),
       descriptor_buffer_mode((RayTracingCreateInfo().flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(RayTracingCreateInfo().pNext, *this)),
       uses_pipeline_vertex_robustness(false),
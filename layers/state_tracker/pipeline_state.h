@@ -134,6 +134,10 @@ class Pipeline : public StateObject {
 
     // Which state is dynamic from pipeline creation, factors in GPL sub state as well
     CBDynamicFlags dynamic_state;
+    // The dynamic states that must have been set before any draw with this pipeline, whatever the rest of the bound state is.
+    // Built once here so draws only look at the states that can actually be missing, states that are only needed for some
+    // draw time state (ex. line width for line topologies) are left to the draw validation.
+    const CBDynamicFlags draw_required_dynamic_state;
 
     const VkPrimitiveTopology topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
     const bool descriptor_buffer_mode = false;
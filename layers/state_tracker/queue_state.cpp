@@ -18,6 +18,9 @@
  */
 #include "state_tracker/queue_state.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "state_tracker/state_tracker.h"
+
+#include <algorithm>
 
 void vvl::QueueSubmission::BeginUse() {
     for (auto &wait : wait_semaphores) {
@@ -85,23 +88,22 @@ uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions)
         {
             auto guard = Lock();
             submissions_.emplace_back(std::move(submission));
-            if (!thread_) {
-                thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
-            }
         }
     }
     return retire_early_seq;
 }
 
 void vvl::Queue::Notify(uint64_t until_seq) {
-    auto guard = Lock();
-    if (until_seq == kU64Max) {
-        until_seq = seq_.load();
-    }
-    if (request_seq_ < until_seq) {
-        request_seq_ = until_seq;
+    {
+        auto guard = Lock();
+        if (until_seq == kU64Max) {
+            until_seq = seq_.load();
+        }
+        if (request_seq_ < until_seq) {
+            request_seq_ = until_seq;
+        }
     }
-    cond_.notify_one();
+    dev_data_.queue_retirement_scheduler->Schedule(*this);
 }
 
 void vvl::Queue::Wait(const Location &loc, uint64_t until_seq) {
@@ -134,17 +136,7 @@ void vvl::Queue::NotifyAndWait(const Location &loc, uint64_t until_seq) {
 }
 
 void vvl::Queue::Destroy() {
-    std::unique_ptr<std::thread> dead_thread;
-    {
-        auto guard = Lock();
-        exit_thread_ = true;
-        cond_.notify_all();
-        dead_thread = std::move(thread_);
-    }
-    if (dead_thread && dead_thread->joinable()) {
-        dead_thread->join();
-        dead_thread.reset();
-    }
+    dev_data_.queue_retirement_scheduler->Cancel(*this);
     StateObject::Destroy();
 }
 
@@ -157,17 +149,24 @@ void vvl::Queue::PostSubmit() {
 
 vvl::QueueSubmission *vvl::Queue::NextSubmission() {
     QueueSubmission *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
-    // about locking.
-    auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
-        // The queue thread must wait forever if nothing is happening, until we tell it to exit
-        cond_.wait(guard);
-    }
-    if (!exit_thread_) {
-        result = &submissions_.front();
+    {
+        auto guard = Lock();
+        if (submissions_.empty() || request_seq_ < submissions_.front().seq) {
+            return nullptr;
+        }
         // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
+        // anyone waiting for it can find the correct waiter. Only the scheduler thread pops the deque and
+        // emplace_back() does not invalidate references, so the pointer stays valid without the lock.
+        result = &submissions_.front();
+    }
+    // Semaphore locks are taken before queue locks (Semaphore::Retire notifies queues), so check without holding lock_
+    for (const auto &wait : result->wait_semaphores) {
+        if (!wait.semaphore->CanRetire(this, wait.payload)) {
+            // The app can wait only on this queue, so the signaling queue must be requested to make progress too.
+            // Its retirement of the payload notifies this queue again.
+            wait.semaphore->NotifySignaler(wait.payload);
+            return nullptr;
+        }
     }
     return result;
 }
@@ -213,15 +212,9 @@ void vvl::Queue::Retire(QueueSubmission &submission) {
     }
 }
 
-void vvl::Queue::ThreadFunc() {
-    QueueSubmission *submission = nullptr;
-
+void vvl::Queue::RetireReadySubmissions() {
     // Roll this queue forward, one submission at a time.
-    while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
-            break;
-        }
+    while (QueueSubmission *submission = NextSubmission()) {
         Retire(*submission);
         // wake up anyone waiting for this submission to be retired
         {
@@ -235,3 +228,70 @@ void vvl::Queue::ThreadFunc() {
         }
     }
 }
+
+vvl::QueueRetirementScheduler::~QueueRetirementScheduler() {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_thread_ = true;
+    }
+    cond_.notify_all();
+    if (thread_ && thread_->joinable()) {
+        thread_->join();
+    }
+}
+
+void vvl::QueueRetirementScheduler::Schedule(Queue &queue) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (queue.scheduled_ || queue.retirement_cancelled_) {
+            // Already going to be looked at, this is what batches the wakeups
+            return;
+        }
+        queue.scheduled_ = true;
+        scheduled_.emplace_back(&queue);
+        if (!thread_) {
+            thread_ = std::make_unique<std::thread>(&QueueRetirementScheduler::ThreadFunc, this);
+        }
+    }
+    cond_.notify_one();
+}
+
+void vvl::QueueRetirementScheduler::Cancel(Queue &queue) {
+    std::unique_lock<std::mutex> guard(lock_);
+    queue.retirement_cancelled_ = true;
+    queue.scheduled_ = false;
+    for (auto *queues : {&scheduled_, &batch_}) {
+        auto it = std::find(queues->begin(), queues->end(), &queue);
+        if (it != queues->end()) {
+            *it = nullptr;
+        }
+    }
+    idle_cond_.wait(guard, [this, &queue]() { return running_ != &queue; });
+}
+
+void vvl::QueueRetirementScheduler::ThreadFunc() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        cond_.wait(guard, [this]() { return exit_thread_ || !scheduled_.empty(); });
+        if (exit_thread_) {
+            break;
+        }
+        // Everything scheduled since the last wakeup is handled in one go
+        batch_.swap(scheduled_);
+        for (size_t i = 0; i < batch_.size(); ++i) {
+            Queue *queue = batch_[i];
+            // Cancel() can have removed the queue while the lock was released for the previous one
+            if (!queue) {
+                continue;
+            }
+            queue->scheduled_ = false;
+            running_ = queue;
+            guard.unlock();
+            queue->RetireReadySubmissions();
+            guard.lock();
+            running_ = nullptr;
+            idle_cond_.notify_all();
+        }
+        batch_.clear();
+    }
+}
@@ -76,6 +76,37 @@ static inline std::chrono::time_point<std::chrono::steady_clock> GetCondWaitTime
     return std::chrono::steady_clock::now() + std::chrono::seconds(10);
 }
 
+// Retires the submissions of all the queues of a device on a single thread, instead of one thread per queue. The chassis
+// creates one per device and shares it with all the validation objects, like the thread pool.
+//
+// Queues are scheduled when Notify() moves their request_seq_ forward. The scheduler thread takes all the scheduled queues at
+// once and retires, for each of them, every requested submission whose semaphore waits can be retired without blocking.
+// A submission waiting on a semaphore signaled by another queue is left in place, it gets rescheduled when the signaling
+// queue retires the signal (Semaphore::Retire notifies the waiting queues). Per queue, submissions still retire in order.
+class QueueRetirementScheduler {
+  public:
+    ~QueueRetirementScheduler();
+
+    void Schedule(Queue &queue);
+    // Called when a queue is destroyed, returns once the scheduler is no longer using the queue
+    void Cancel(Queue &queue);
+
+  private:
+    void ThreadFunc();
+
+    std::mutex lock_;
+    // wakes up the scheduler thread
+    std::condition_variable cond_;
+    // signaled each time the scheduler is done with a queue
+    std::condition_variable idle_cond_;
+    std::unique_ptr<std::thread> thread_;
+    std::vector<Queue *> scheduled_;
+    // queues being processed by the scheduler thread, cancelled queues are set to nullptr
+    std::vector<Queue *> batch_;
+    Queue *running_{nullptr};
+    bool exit_thread_{false};
+};
+
 class Queue: public StateObject {
   public:
     Queue(ValidationStateTracker &dev_data, VkQueue handle, uint32_t index, VkDeviceQueueCreateFlags flags,
@@ -96,11 +127,11 @@ class Queue: public StateObject {
     // called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit();
 
-    // Tell the queue thread that submissions up to and including the submission with
+    // Tell the retirement scheduler that submissions up to and including the submission with
     // sequence number until_seq have finished. kU64Max means to finish all submissions.
     void Notify(uint64_t until_seq = kU64Max);
 
-    // Wait for the queue thread to finish processing submissions with sequence numbers
+    // Wait for the retirement scheduler to finish processing submissions with sequence numbers
     // up to and including until_seq. kU64Max means to finish all submissions.
     void Wait(const Location &loc, uint64_t until_seq = kU64Max);
 
@@ -125,12 +156,14 @@ class Queue: public StateObject {
   protected:
     // called from the various PostCallRecordQueueSubmit() methods
     virtual void PostSubmit(QueueSubmission &submission) {}
-    // called when the worker thread decides a submissions has finished executing
+    // called when the retirement scheduler decides a submissions has finished executing
     virtual void Retire(QueueSubmission &submission);
 
   private:
+    friend class QueueRetirementScheduler;
     using LockGuard = std::unique_lock<std::mutex>;
-    void ThreadFunc();
+    // Called on the scheduler thread, retires submissions until one is not requested yet or would block
+    void RetireReadySubmissions();
     QueueSubmission *NextSubmission();
     LockGuard Lock() const { return LockGuard(lock_); }
 
@@ -138,13 +171,13 @@ class Queue: public StateObject {
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
-    std::unique_ptr<std::thread> thread_;
     std::deque<QueueSubmission> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
-    bool exit_thread_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
-    std::condition_variable cond_;
+
+    // Owned by QueueRetirementScheduler::lock_
+    bool scheduled_{false};
+    bool retirement_cancelled_{false};
 };
 } // namespace vvl
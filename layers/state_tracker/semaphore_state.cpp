@@ -222,6 +222,10 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
     }
 
     if (retire_here) {
+        // Waits for smaller timeline values are satisfied too, wake up the queues that could be blocked on them
+        for (auto earlier = timeline_.begin(); earlier != pos; ++earlier) {
+            earlier->second.Notify();
+        }
         if (timepoint.signal_submit) {
             completed_ = SemOp(kSignal, *timepoint.signal_submit, payload);
         }
@@ -255,6 +259,37 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
     }
 }
 
+bool vvl::Semaphore::CanRetire(const vvl::Queue *current_queue, uint64_t payload) const {
+    auto guard = ReadLock();
+    if (payload <= completed_.payload) {
+        return true;
+    }
+    auto pos = timeline_.find(payload);
+    if (pos == timeline_.end()) {
+        return true;
+    }
+    // Must match the retire_here logic of Retire()
+    const auto &timepoint = pos->second;
+    if (timepoint.signal_submit) {
+        return timepoint.signal_submit->queue == current_queue;
+    }
+    return timepoint.acquire_command || scope_ != kInternal;
+}
+
+void vvl::Semaphore::NotifySignaler(uint64_t payload) const {
+    auto guard = ReadLock();
+    // A timeline wait is satisfied by the first signal of a payload at least as large
+    for (auto pos = timeline_.lower_bound(payload); pos != timeline_.end(); ++pos) {
+        const auto &signal_submit = pos->second.signal_submit;
+        if (signal_submit) {
+            if (signal_submit->queue) {
+                signal_submit->queue->Notify(signal_submit->seq);
+            }
+            break;
+        }
+    }
+}
+
 std::shared_future<void> vvl::Semaphore::Wait(uint64_t payload) {
     auto guard = WriteLock();
     if (payload <= completed_.payload) {
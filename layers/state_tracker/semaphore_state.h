@@ -89,6 +89,11 @@ class Semaphore : public RefcountedStateObject {
 
     // Remove completed operations and signal any waiters. This should only be called by Queue
     void Retire(Queue *current_queue, const Location &loc, uint64_t payload);
+    // False if Retire() would have to wait for another queue or a host operation to retire the payload first
+    bool CanRetire(const Queue *current_queue, uint64_t payload) const;
+    // Request the queue signaling the payload to retire up to the signal, for a queue that can't retire its wait yet.
+    // Unlike Notify(), the other queues waiting for the payload are not notified, they would wake each other up in a loop.
+    void NotifySignaler(uint64_t payload) const;
 
     // Look for most recent / highest payload operation that matches
     std::optional<SemOp> LastOp(
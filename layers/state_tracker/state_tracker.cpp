@@ -381,13 +381,15 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
     if (pCreateInfo) {
         const auto *opaque_capture_address = vku::FindStructInPNextChain<VkBufferOpaqueCaptureAddressCreateInfo>(pCreateInfo->pNext);
         if (opaque_capture_address && (opaque_capture_address->opaqueCaptureAddress != 0)) {
-            WriteLockGuard guard(buffer_address_lock_);
-            // address is used for GPU-AV and ray tracing buffer validation
-            buffer_state->deviceAddress = opaque_capture_address->opaqueCaptureAddress;
-            const auto address_range = buffer_state->DeviceAddressRange();
-
-            BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
-            sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            buffer_address_map_.Update([&buffer_state, opaque_capture_address](BufferAddressRangeMap &address_map) {
+                // address is used for GPU-AV and ray tracing buffer validation
+                buffer_state->deviceAddress = opaque_capture_address->opaqueCaptureAddress;
+                const auto address_range = buffer_state->DeviceAddressRange();
+
+                BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
+                sparse_container::infill_update_range(address_map, address_range, ops);
+                return true;
+            });
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -511,8 +513,6 @@ void ValidationStateTracker::PreCallRecordDestroyImageView(VkDevice device, VkIm
 void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator,
                                                         const RecordObject &record_obj) {
     if (auto buffer_state = Get<vvl::Buffer>(buffer)) {
-        WriteLockGuard guard(buffer_address_lock_);
-
         const VkBufferUsageFlags descriptor_buffer_usages =
             VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
 
@@ -526,10 +526,13 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
                 samplerDescriptorBufferAddressSpaceSize -= buffer_state->create_info.size;
         }
 
-        if (buffer_state->deviceAddress != 0) {
+        buffer_address_map_.Update([&buffer_state](BufferAddressRangeMap &address_map) {
+            if (buffer_state->deviceAddress == 0) {
+                return false;
+            }
             const auto address_range = buffer_state->DeviceAddressRange();
 
-            buffer_address_map_.erase_range_or_touch(address_range, [buffer_state_raw = buffer_state.get()](auto &buffers) {
+            address_map.erase_range_or_touch(address_range, [buffer_state_raw = buffer_state.get()](auto &buffers) {
                 assert(!buffers.empty());
                 const auto buffer_found_it = std::find(buffers.begin(), buffers.end(), buffer_state_raw);
                 assert(buffer_found_it != buffers.end());
@@ -550,7 +553,8 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
-        }
+            return true;
+        });
     }
     Destroy<vvl::Buffer>(buffer);
 }
@@ -3247,11 +3251,21 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
                                            std::move(views)));
 }
 
+std::shared_ptr<vvl::RenderPass> ValidationStateTracker::CreateRenderPassState(VkRenderPass handle,
+                                                                               const VkRenderPassCreateInfo *pCreateInfo) {
+    return std::make_shared<vvl::RenderPass>(handle, pCreateInfo);
+}
+
+std::shared_ptr<vvl::RenderPass> ValidationStateTracker::CreateRenderPassState(VkRenderPass handle,
+                                                                               const VkRenderPassCreateInfo2 *pCreateInfo) {
+    return std::make_shared<vvl::RenderPass>(handle, pCreateInfo);
+}
+
 void ValidationStateTracker::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                             const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::RenderPass>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
@@ -3265,7 +3279,7 @@ void ValidationStateTracker::PostCallRecordCreateRenderPass2(VkDevice device, co
                                                              const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
 
-    Add(std::make_shared<vvl::RenderPass>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
@@ -5577,14 +5591,19 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
                                                                   const RecordObject &record_obj) {
     auto buffer_state = Get<vvl::Buffer>(pInfo->buffer);
     if (buffer_state && record_obj.device_address != 0) {
-        WriteLockGuard guard(buffer_address_lock_);
-        // address is used for GPU-AV and ray tracing buffer validation
-        buffer_state->deviceAddress = record_obj.device_address;
-        const auto address_range = buffer_state->DeviceAddressRange();
-
-        BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
-        sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
-        buffer_device_address_ranges_version++;
+        buffer_address_map_.Update([&buffer_state, &record_obj](BufferAddressRangeMap &address_map) {
+            // Applications often query the address of the same buffer again, the map already has it
+            if (buffer_state->deviceAddress == record_obj.device_address) {
+                return false;
+            }
+            // address is used for GPU-AV and ray tracing buffer validation
+            buffer_state->deviceAddress = record_obj.device_address;
+            const auto address_range = buffer_state->DeviceAddressRange();
+
+            BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
+            sparse_container::infill_update_range(address_map, address_range, ops);
+            return true;
+        });
     }
 }
 
@@ -22,6 +22,8 @@
 #include "generated/chassis.h"
 #include "utils/hash_vk_types.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/queue_state.h"
+#include "state_tracker/buffer_address_map.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/state_tracker_helper.h"
 #include "error_message/logging.h"
@@ -29,6 +31,7 @@
 #include "utils/android_ndk_types.h"
 #include "containers/range_vector.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -408,37 +411,26 @@ class ValidationStateTracker : public ValidationObject {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
-    vvl::span<vvl::Buffer*> GetBuffersByAddress(VkDeviceAddress address) {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer*>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    // Lookups do not take any lock, they search the last published snapshot of the map.
+    vvl::BufferAddressLookup GetBuffersByAddress(VkDeviceAddress address) const { return buffer_address_map_.Find(address); }
 
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
+    // Same as GetBuffersByAddress for many addresses at once, all resolved against the same snapshot in a single pass.
+    // Prefer it when validating arrays of device addresses.
+    vvl::BufferAddressBatchLookup GetBuffersByAddresses(vvl::span<const VkDeviceAddress> addresses) const {
+        return buffer_address_map_.FindBatch(addresses);
     }
 
+    // Changes each time a buffer address range is added or removed
+    uint32_t GetBufferAddressRangesVersion() const { return buffer_address_map_.Version(); }
+
     // Return a count pair, {written addresses count, total address ranges count}
     using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
     [[nodiscard]] std::pair<size_t, size_t> GetBufferAddressRanges(BufferAddressRange* ranges, size_t ranges_size) const {
-        ReadLockGuard guard(buffer_address_lock_);
-
-        size_t written_count = 0;
-        for (const auto& [address_range, buffers] : buffer_address_map_) {
-            if (written_count == ranges_size) {
-                break;
-            }
-            ranges[written_count++] = address_range;
-        }
-        return {written_count, buffer_address_map_.size()};
+        const auto snapshot = buffer_address_map_.Read();
+        const auto& address_ranges = snapshot->Ranges();
+        const size_t written_count = std::min(ranges_size, address_ranges.size());
+        std::copy_n(address_ranges.begin(), written_count, ranges);
+        return {written_count, address_ranges.size()};
     }
 
     using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, const vvl::ImageView&, VkImageLayout)>;
@@ -839,6 +831,8 @@ class ValidationStateTracker : public ValidationObject {
                                                     const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                     const RecordObject& record_obj, PipelineStates& pipeline_states,
                                                     chassis::CreateRayTracingPipelinesKHR& chassis_state) override;
+    virtual std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle, const VkRenderPassCreateInfo* pCreateInfo);
+    virtual std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle, const VkRenderPassCreateInfo2* pCreateInfo);
     void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass,
                                         const RecordObject& record_obj) override;
@@ -1861,12 +1855,11 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<QueueFamilyExtensionProperties> queue_family_ext_props;
 
     bool performance_lock_acquired = false;
-    uint32_t buffer_device_address_ranges_version = 0;
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
 
-    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
-    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    using BufferAddressMapStore = vvl::BufferAddressMapStore;
+    using BufferAddressRangeMap = vvl::BufferAddressRangeMap;
 
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
@@ -1880,8 +1873,7 @@ class ValidationStateTracker : public ValidationObject {
     };
     std::vector<DeviceQueueInfo> device_queue_info_list;
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
-    BufferAddressRangeMap buffer_address_map_;
-    mutable std::shared_mutex buffer_address_lock_;
+    vvl::BufferAddressMap buffer_address_map_;
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -18,6 +18,9 @@
 
 #include "stateless/stateless_validation.h"
 
+#include <array>
+#include <cstring>
+
 bool StatelessValidation::CheckPromotedApiAgainstVulkanVersion(VkInstance instance, const Location &loc,
                                                                const uint32_t promoted_version) const {
     bool skip = false;
@@ -216,8 +219,6 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
     bool skip = false;
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -232,18 +233,36 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
         } else {
             const VkStructureType *start = allowed_types;
             const VkStructureType *end = allowed_types + allowed_type_count;
-            const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
+            const VkBaseOutStructure *head = reinterpret_cast<const VkBaseOutStructure *>(next);
+            const VkBaseOutStructure *current = head;
+
+            // This runs for almost every call, the success path must not allocate or build any string.
+            // Almost all chains are short, the sTypes seen are kept on the stack and, past that, the chain is walked again.
+            constexpr uint32_t kMaxTrackedStructs = 32;
+            std::array<VkStructureType, kMaxTrackedStructs> seen_stypes;
+            uint32_t chain_length = 0;
+            // Moves at half the speed of current, they can only meet again if the chain loops (Floyd's cycle detection)
+            const VkBaseOutStructure *cycle_check = head;
 
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    std::string type_name = string_VkStructureType(current->sType);
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    bool duplicate = false;
+                    if (chain_length <= kMaxTrackedStructs) {
+                        for (uint32_t i = 0; i < chain_length && !duplicate; ++i) {
+                            duplicate = seen_stypes[i] == current->sType;
+                        }
+                    } else {
+                        for (const VkBaseOutStructure *prev = head; prev != current && !duplicate;
+                             prev = reinterpret_cast<const VkBaseOutStructure *>(prev->pNext)) {
+                            duplicate = prev->sType == current->sType;
+                        }
+                    }
+                    if (duplicate && !IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= LogError(stype_vuid, device, pNext_loc,
-                                         "chain contains duplicate structure types: %s appears multiple times.", type_name.c_str());
-                    } else {
-                        unique_stype_check.insert(current->sType);
+                                         "chain contains duplicate structure types: %s appears multiple times.",
+                                         string_VkStructureType(current->sType));
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
@@ -256,8 +275,9 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                     }
                     if (!custom) {
                         if (std::find(start, end, current->sType) == end) {
+                            const char *type_name = string_VkStructureType(current->sType);
                             // String returned by string_VkStructureType for an unrecognized type.
-                            if (type_name.compare("Unhandled VkStructureType") == 0) {
+                            if (strcmp(type_name, "Unhandled VkStructureType") == 0) {
                                 std::string message = "chain includes a structure with unknown VkStructureType (%" PRIu32 "). ";
                                 message += disclaimer;
                                 skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), current->sType, header_version,
@@ -265,7 +285,7 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                             } else {
                                 std::string message = "chain includes a structure with unexpected VkStructureType %s. ";
                                 message += disclaimer;
-                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name.c_str(), header_version,
+                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name, header_version,
                                                  pNext_loc.Fields().c_str());
                             }
                         }
@@ -282,7 +302,20 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                         }
                     }
                 }
+
+                if (chain_length < kMaxTrackedStructs) {
+                    seen_stypes[chain_length] = current->sType;
+                }
+                ++chain_length;
                 current = reinterpret_cast<const VkBaseOutStructure *>(current->pNext);
+                if ((chain_length % 2) == 0) {
+                    cycle_check = reinterpret_cast<const VkBaseOutStructure *>(cycle_check->pNext);
+                }
+                if (current != nullptr && current == cycle_check) {
+                    skip |= LogError("UNASSIGNED-GeneralParameterError-PNextChainCycle", device, pNext_loc,
+                                     "chain contains a cycle, it loops back to %s.", string_VkStructureType(current->sType));
+                    break;
+                }
             }
         }
     }
@@ -421,6 +454,9 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
     }
 
     if (!skip && value != 0) {
+        if (unsupported_flag_bits_built && (value & unsupported_flag_bits[static_cast<uint32_t>(flag_bitmask)]) == 0) {
+            return skip;
+        }
         vvl::Extensions required = IsValidFlagValue(flag_bitmask, value, device_extensions);
         if (!required.empty() && device != VK_NULL_HANDLE) {
             // If called from an instance function, there is no device to base extension support off of
@@ -431,6 +467,25 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
     return skip;
 }
 
+// The generated IsValidFlagValue checks are "any of these bits requires one of these extensions", so testing every bit on its
+// own gives the exact set of bits that would produce an error with the enabled extensions.
+void StatelessValidation::BuildUnsupportedFlagBits() {
+    for (uint32_t i = 1; i < vvl::kFlagBitmaskCount; ++i) {
+        const auto flag_bitmask = static_cast<vvl::FlagBitmask>(i);
+        VkFlags64 unsupported = 0;
+        for (uint32_t bit = 0; bit < 64; ++bit) {
+            const VkFlags64 flag = VkFlags64(1) << bit;
+            if (bit < 32 && !IsValidFlagValue(flag_bitmask, static_cast<VkFlags>(flag), device_extensions).empty()) {
+                unsupported |= flag;
+            } else if (!IsValidFlag64Value(flag_bitmask, flag, device_extensions).empty()) {
+                unsupported |= flag;
+            }
+        }
+        unsupported_flag_bits[i] = unsupported;
+    }
+    unsupported_flag_bits_built = true;
+}
+
 /**
  * Validate a 64 bit Vulkan bitmask value.
  *
@@ -457,6 +512,9 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
     }
 
     if (!skip && value != 0) {
+        if (unsupported_flag_bits_built && (value & unsupported_flag_bits[static_cast<uint32_t>(flag_bitmask)]) == 0) {
+            return skip;
+        }
         vvl::Extensions required = IsValidFlag64Value(flag_bitmask, value, device_extensions);
         if (!required.empty() && device != VK_NULL_HANDLE) {
             // If called from an instance function, there is no device to base extension support off of
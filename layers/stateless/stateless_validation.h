@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <array>
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include "sync/sync_utils.h"
 #include "utils/vk_layer_utils.h"
@@ -38,6 +39,12 @@ class StatelessValidation : public ValidationObject {
     vvl::unordered_map<VkPhysicalDevice, VkPhysicalDeviceProperties *> physical_device_properties_map;
     vvl::unordered_map<VkPhysicalDevice, vvl::unordered_set<vvl::Extension>> device_extensions_enumerated{};
 
+    // For each flag bitmask, the bits that require an extension not enabled on the device. Built once at vkCreateDevice so
+    // ValidateFlags only walks the generated per-extension checks when it is going to report an error.
+    std::array<VkFlags64, vvl::kFlagBitmaskCount> unsupported_flag_bits{};
+    bool unsupported_flag_bits_built = false;
+    void BuildUnsupportedFlagBits();
+
     // This was a special case where it was decided to use the extension version for validation
     // https://gitlab.khronos.org/vulkan/vulkan/-/merge_requests/5671
     inline static uint32_t discard_rectangles_extension_version = 0;
@@ -15,12 +15,15 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/video_session_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_image.h"
+#include "utils/thread_pool.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
@@ -29,10 +32,10 @@ class HazardDetector {
     const SyncStageAccessInfoType &usage_info_;
 
   public:
-    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const { return pos->second.DetectHazard(usage_info_); }
-    HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, ResourceUsageTag start_tag,
+    HazardResult Detect(const ResourceAccessRangeMap::value_type &entry) const { return entry.second.DetectHazard(usage_info_); }
+    HazardResult DetectAsync(const ResourceAccessRangeMap::value_type &entry, ResourceUsageTag start_tag,
                              QueueId queue_id) const {
-        return pos->second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
+        return entry.second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
     }
     explicit HazardDetector(SyncStageAccessIndex usage_index) : usage_info_(SyncStageAccess::UsageInfo(usage_index)) {}
 };
@@ -42,27 +45,44 @@ class HazardDetectorWithOrdering {
     const SyncOrdering ordering_rule_;
 
   public:
-    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const {
-        return pos->second.DetectHazard(usage_info_, ordering_rule_, kQueueIdInvalid);
+    HazardResult Detect(const ResourceAccessRangeMap::value_type &entry) const {
+        return entry.second.DetectHazard(usage_info_, ordering_rule_, kQueueIdInvalid);
     }
-    HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, ResourceUsageTag start_tag,
+    HazardResult DetectAsync(const ResourceAccessRangeMap::value_type &entry, ResourceUsageTag start_tag,
                              QueueId queue_id) const {
-        return pos->second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
+        return entry.second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
     }
     HazardDetectorWithOrdering(SyncStageAccessIndex usage_index, SyncOrdering ordering)
         : usage_info_(SyncStageAccess::UsageInfo(usage_index)), ordering_rule_(ordering) {}
 };
 
+class HazardDetectorBeforeTag {
+    const SyncStageAccessInfoType &usage_info_;
+    const SyncOrdering ordering_rule_;
+    const ResourceUsageTag tag_limit_;
+
+  public:
+    HazardResult Detect(const ResourceAccessRangeMap::value_type &entry) const {
+        return entry.second.DetectHazardBeforeTag(usage_info_, ordering_rule_, tag_limit_);
+    }
+    HazardResult DetectAsync(const ResourceAccessRangeMap::value_type &entry, ResourceUsageTag start_tag,
+                             QueueId queue_id) const {
+        return entry.second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
+    }
+    HazardDetectorBeforeTag(SyncStageAccessIndex usage_index, SyncOrdering ordering, ResourceUsageTag tag_limit)
+        : usage_info_(SyncStageAccess::UsageInfo(usage_index)), ordering_rule_(ordering), tag_limit_(tag_limit) {}
+};
+
 class HazardDetectFirstUse {
   public:
     HazardDetectFirstUse(const ResourceAccessState &recorded_use, QueueId queue_id, const ResourceUsageRange &tag_range)
         : recorded_use_(recorded_use), queue_id_(queue_id), tag_range_(tag_range) {}
-    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const {
-        return pos->second.DetectHazard(recorded_use_, queue_id_, tag_range_);
+    HazardResult Detect(const ResourceAccessRangeMap::value_type &entry) const {
+        return entry.second.DetectHazard(recorded_use_, queue_id_, tag_range_);
     }
-    HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, ResourceUsageTag start_tag,
+    HazardResult DetectAsync(const ResourceAccessRangeMap::value_type &entry, ResourceUsageTag start_tag,
                              QueueId queue_id) const {
-        return pos->second.DetectAsyncHazard(recorded_use_, tag_range_, start_tag, queue_id);
+        return entry.second.DetectAsyncHazard(recorded_use_, tag_range_, start_tag, queue_id);
     }
 
   private:
@@ -71,35 +91,59 @@ class HazardDetectFirstUse {
     const ResourceUsageRange &tag_range_;
 };
 
-AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
-                             const std::vector<SubpassDependencyGraphNode> &dependencies,
-                             const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
-    Reset();
-    const auto &subpass_dep = dependencies[subpass];
-    const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
-    prev_.reserve(subpass_dep.prev.size() + (has_barrier_from_external ? 1U : 0U));
-    prev_by_subpass_.resize(subpass, nullptr);  // Can't be more prevs than the subpass we're on
-    for (const auto &prev_dep : subpass_dep.prev) {
-        const auto prev_pass = prev_dep.first->pass;
-        const auto &prev_barriers = prev_dep.second;
+static std::vector<SyncBarrier> MakeSubpassBarriers(VkQueueFlags queue_flags,
+                                                    const std::vector<const VkSubpassDependency2 *> &dependencies) {
+    std::vector<SyncBarrier> barriers;
+    barriers.reserve(dependencies.size());
+    for (const VkSubpassDependency2 *dependency : dependencies) {
+        assert(dependency);
+        barriers.emplace_back(queue_flags, *dependency);
+    }
+    return barriers;
+}
+
+SubpassBarriers::SubpassBarriers(VkQueueFlags queue_flags, const SubpassDependencyGraphNode &dependency)
+    : subpass(dependency.pass),
+      prev(),
+      async(dependency.async),
+      from_external(MakeSubpassBarriers(queue_flags, dependency.barrier_from_external)),
+      to_external(MakeSubpassBarriers(queue_flags, dependency.barrier_to_external)) {
+    prev.reserve(dependency.prev.size());
+    for (const auto &prev_dep : dependency.prev) {
         assert(prev_dep.second.size());
-        prev_.emplace_back(&contexts[prev_pass], queue_flags, prev_barriers);
-        prev_by_subpass_[prev_pass] = &prev_.back();
+        prev.emplace_back(Prev{prev_dep.first->pass, MakeSubpassBarriers(queue_flags, prev_dep.second)});
     }
+}
 
-    async_.reserve(subpass_dep.async.size());
-    for (const auto async_subpass : subpass_dep.async) {
+AccessContext::AccessContext(const SubpassBarriers &subpass_barriers, const std::vector<AccessContext> &contexts,
+                             const AccessContext *external_context) {
+    InitSubpass(subpass_barriers, contexts, external_context);
+}
+
+void AccessContext::InitSubpass(const SubpassBarriers &subpass_barriers, const std::vector<AccessContext> &contexts,
+                                const AccessContext *external_context) {
+    Reset();
+    const bool has_barrier_from_external = !subpass_barriers.from_external.empty();
+    prev_.reserve(subpass_barriers.prev.size() + (has_barrier_from_external ? 1U : 0U));
+    prev_by_subpass_.resize(subpass_barriers.subpass, nullptr);  // Can't be more prevs than the subpass we're on
+    for (const auto &prev_dep : subpass_barriers.prev) {
+        prev_.emplace_back(&contexts[prev_dep.subpass], prev_dep.barriers);
+        prev_by_subpass_[prev_dep.subpass] = &prev_.back();
+    }
+
+    async_.reserve(subpass_barriers.async.size());
+    for (const auto async_subpass : subpass_barriers.async) {
         // Start tags are not known at creation time (as it's done at BeginRenderpass)
         async_.emplace_back(contexts[async_subpass], kInvalidTag, kQueueIdInvalid);
     }
 
     if (has_barrier_from_external) {
         // Store the barrier from external with the reat, but save pointer for "by subpass" lookups.
-        prev_.emplace_back(external_context, queue_flags, subpass_dep.barrier_from_external);
+        prev_.emplace_back(external_context, subpass_barriers.from_external);
         src_external_ = &prev_.back();
     }
-    if (subpass_dep.barrier_to_external.size()) {
-        dst_external_ = TrackBack(this, queue_flags, subpass_dep.barrier_to_external);
+    if (!subpass_barriers.to_external.empty()) {
+        dst_external_ = TrackBack(this, subpass_barriers.to_external);
     }
 }
 
@@ -129,6 +173,7 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
 
 template <typename Action>
 void AccessContext::ForAll(Action &&action) {
+    ApplyPendingGlobalBarriers();
     for (auto &access : access_state_map_) {
         action(access);
     }
@@ -136,12 +181,14 @@ void AccessContext::ForAll(Action &&action) {
 
 template <typename Action>
 void AccessContext::ConstForAll(Action &&action) const {
+    std::optional<ResourceAccessRangeMap::value_type> scratch;
     for (auto &access : access_state_map_) {
-        action(access);
+        action(CurrentEntry(access, scratch));
     }
 }
 
 void AccessContext::ResolveFromContext(const AccessContext &from) {
+    ApplyPendingGlobalBarriers();
     const NoopBarrierAction noop_barrier;
     from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
 }
@@ -176,6 +223,7 @@ void AccessContext::ResolvePreviousAccesses() {
     ResourceAccessState default_state;
     if (!prev_.size()) return;  // If no previous contexts, nothing to do
 
+    ApplyPendingGlobalBarriers();
     ResolvePreviousAccess(kFullRange, &access_state_map_, &default_state);
 }
 
@@ -247,11 +295,67 @@ void AccessContext::UpdateAccessState(const ImageRangeGen &range_gen, SyncStageA
 }
 
 void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts) {
+    ApplyPendingGlobalBarriers();
     for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
         auto &context = contexts[subpass_index];
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
-        context.ResolveAccessRange(kFullRange, barrier_action, &access_state_map_, nullptr, false);
+        // Resolve only the ranges the subpass accessed, merging with kFullRange would step over every entry of this map
+        const auto &child_map = context.access_state_map_;
+        for (auto pos = child_map.cbegin(); pos != child_map.cend();) {
+            ResourceAccessRange accessed = pos->first;
+            for (++pos; pos != child_map.cend() && pos->first.begin == accessed.end; ++pos) {
+                accessed.end = pos->first.end;
+            }
+            context.ResolveAccessRange(accessed, barrier_action, &access_state_map_, nullptr, false);
+        }
+    }
+}
+
+// Past this many batches they are applied to the whole map, to bound the memory used by a long command buffer
+static constexpr size_t kMaxPendingGlobalBarriers = 1024;
+
+AccessContext::AccessContext(const AccessContext &copy_from)
+    : access_state_map_(copy_from.access_state_map_),
+      global_barriers_(copy_from.global_barriers_),
+      global_barrier_seq_(copy_from.global_barrier_seq_),
+      prev_(copy_from.prev_),
+      prev_by_subpass_(copy_from.prev_by_subpass_),
+      async_(copy_from.async_),
+      src_external_(copy_from.src_external_),
+      dst_external_(copy_from.dst_external_),
+      start_tag_(copy_from.start_tag_) {
+    ApplyPendingGlobalBarriers();
+}
+
+void AccessContext::RecordGlobalBarriers(QueueId queue_id, const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag) {
+    if (global_barriers_.size() >= kMaxPendingGlobalBarriers) {
+        ApplyPendingGlobalBarriers();
+    }
+    const uint64_t seq = ++global_barrier_seq_;
+    global_barriers_.emplace_back(GlobalBarrierBatch{seq, queue_id, tag, barriers});
+}
+
+void AccessContext::ApplyPendingGlobalBarriers() {
+    if (global_barriers_.empty()) return;
+    for (auto &access : access_state_map_) {
+        ApplyPendingGlobalBarriers(access.second);
+    }
+    global_barriers_.clear();
+}
+
+void AccessContext::ApplyPendingGlobalBarriers(ResourceAccessState &access) const {
+    if (!HasPendingGlobalBarriers(access)) return;
+    // Batches are in seq order, apply the ones recorded after the state was last brought up to date
+    auto batch = std::upper_bound(global_barriers_.begin(), global_barriers_.end(), access.GlobalBarrierSeq(),
+                                  [](uint64_t seq, const GlobalBarrierBatch &batch) { return seq < batch.seq; });
+    for (; batch != global_barriers_.end(); ++batch) {
+        const ResourceAccessState::QueueScopeOps scope(batch->queue_id);
+        for (const auto &barrier : batch->barriers) {
+            access.ApplyBarrier(scope, barrier, false);
+        }
+        access.ApplyPendingBarriers(batch->tag);
     }
+    access.SetGlobalBarrierSeq(global_barriers_.back().seq);
 }
 
 // Caller must ensure that lifespan of this is less than the lifespan of from
@@ -293,6 +397,15 @@ HazardResult AccessContext::DetectHazard(const vvl::Buffer &buffer, SyncStageAcc
     return DetectHazardRange(detector, (range + base_address), DetectOptions::kDetectAll);
 }
 
+// The range walkers only know the hazardous address, the image subresource is decoded once a hazard is found
+static HazardResult WithImageSubresource(HazardResult &&hazard, const syncval_state::ImageState *image) {
+    VkImageSubresource subresource;
+    if (hazard.IsHazard() && image && image->GetSubresourceAtAddress(hazard.State().address, subresource)) {
+        hazard.SetImageSubresource(subresource);
+    }
+    return std::move(hazard);
+}
+
 template <typename Detector>
 HazardResult AccessContext::DetectHazard(Detector &detector, const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                                          DetectOptions options) const {
@@ -300,7 +413,8 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const AttachmentVie
     if (!attachment_gen) return HazardResult();
 
     subresource_adapter::ImageRangeGenerator range_gen(*attachment_gen);
-    return DetectHazardGeneratedRanges(detector, range_gen, options);
+    const ImageViewState *view = view_gen.GetViewState();
+    return WithImageSubresource(DetectHazardGeneratedRanges(detector, range_gen, options), view ? view->GetImageState() : nullptr);
 }
 
 template <typename Detector>
@@ -309,7 +423,7 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const ImageState &i
                                          const VkExtent3D &extent, bool is_depth_sliced, DetectOptions options) const {
     // range_gen is non-temporary to avoid additional copy
     ImageRangeGen range_gen = image.MakeImageRangeGen(subresource_range, offset, extent, is_depth_sliced);
-    return DetectHazardGeneratedRanges(detector, range_gen, options);
+    return WithImageSubresource(DetectHazardGeneratedRanges(detector, range_gen, options), &image);
 }
 
 template <typename Detector>
@@ -318,7 +432,7 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const ImageState &i
                                          DetectOptions options) const {
     // range_gen is non-temporary to avoid additional copy
     ImageRangeGen range_gen = image.MakeImageRangeGen(subresource_range, is_depth_sliced);
-    return DetectHazardGeneratedRanges(detector, range_gen, options);
+    return WithImageSubresource(DetectHazardGeneratedRanges(detector, range_gen, options), &image);
 }
 
 HazardResult AccessContext::DetectHazard(const ImageState &image, SyncStageAccessIndex current_usage,
@@ -330,7 +444,8 @@ HazardResult AccessContext::DetectHazard(const ImageState &image, SyncStageAcces
 HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, SyncStageAccessIndex current_usage) const {
     // Get is const, but callee will copy
     HazardDetector detector(current_usage);
-    return DetectHazardGeneratedRanges(detector, image_view.GetFullViewImageRangeGen(), DetectOptions::kDetectAll);
+    auto hazard = DetectHazardGeneratedRanges(detector, image_view.GetFullViewImageRangeGen(), DetectOptions::kDetectAll);
+    return WithImageSubresource(std::move(hazard), image_view.GetImageState());
 }
 
 HazardResult AccessContext::DetectHazard(const ImageRangeGen &ref_range_gen, SyncStageAccessIndex current_usage,
@@ -349,7 +464,8 @@ HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, const
     // range_gen is non-temporary to avoid an additional copy
     ImageRangeGen range_gen(image_view.MakeImageRangeGen(offset, extent));
     HazardDetectorWithOrdering detector(current_usage, ordering_rule);
-    return DetectHazardGeneratedRanges(detector, range_gen, DetectOptions::kDetectAll);
+    return WithImageSubresource(DetectHazardGeneratedRanges(detector, range_gen, DetectOptions::kDetectAll),
+                                image_view.GetImageState());
 }
 
 HazardResult AccessContext::DetectHazard(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
@@ -358,6 +474,22 @@ HazardResult AccessContext::DetectHazard(const AttachmentViewGen &view_gen, Atta
     return DetectHazard(detector, view_gen, gen_type, DetectOptions::kDetectAll);
 }
 
+HazardResult AccessContext::DetectHazardBeforeTag(const vvl::Buffer &buffer, SyncStageAccessIndex usage_index,
+                                                  const ResourceAccessRange &range, ResourceUsageTag tag_limit) const {
+    if (!SimpleBinding(buffer)) return HazardResult();
+    const auto base_address = ResourceBaseAddress(buffer);
+    HazardDetectorBeforeTag detector(usage_index, SyncOrdering::kOrderingNone, tag_limit);
+    return DetectHazardRange(detector, (range + base_address), DetectOptions::kDetectAll);
+}
+
+HazardResult AccessContext::DetectHazardBeforeTag(const ImageViewState &image_view, const ImageRangeGen &range_gen,
+                                                  SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
+                                                  ResourceUsageTag tag_limit) const {
+    HazardDetectorBeforeTag detector(current_usage, ordering_rule, tag_limit);
+    return WithImageSubresource(DetectHazardGeneratedRanges(detector, range_gen, DetectOptions::kDetectAll),
+                                image_view.GetImageState());
+}
+
 HazardResult AccessContext::DetectHazard(const vvl::VideoSession &vs_state, const vvl::VideoPictureResource &resource,
                                          SyncStageAccessIndex current_usage) const {
     const auto image = static_cast<const ImageState *>(resource.image_state.get());
@@ -365,7 +497,7 @@ HazardResult AccessContext::DetectHazard(const vvl::VideoSession &vs_state, cons
     const auto extent = resource.GetEffectiveImageExtent(vs_state);
     ImageRangeGen range_gen(image->MakeImageRangeGen(resource.range, offset, extent, false));
     HazardDetector detector(current_usage);
-    return DetectHazardGeneratedRanges(detector, range_gen, DetectOptions::kDetectAll);
+    return WithImageSubresource(DetectHazardGeneratedRanges(detector, range_gen, DetectOptions::kDetectAll), image);
 }
 
 HazardResult AccessContext::DetectHazard(const ImageState &image, const VkImageSubresourceRange &subresource_range,
@@ -387,13 +519,13 @@ class BarrierHazardDetector {
           src_exec_scope_(src_exec_scope),
           src_access_scope_(src_access_scope) {}
 
-    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) const {
-        return pos->second.DetectBarrierHazard(usage_info_, kQueueIdInvalid, src_exec_scope_, src_access_scope_);
+    HazardResult Detect(const ResourceAccessRangeMap::value_type &entry) const {
+        return entry.second.DetectBarrierHazard(usage_info_, kQueueIdInvalid, src_exec_scope_, src_access_scope_);
     }
-    HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, ResourceUsageTag start_tag,
+    HazardResult DetectAsync(const ResourceAccessRangeMap::value_type &entry, ResourceUsageTag start_tag,
                              QueueId queue_id) const {
         // Async barrier hazard detection can use the same path as the usage index is not IsRead, but is IsWrite
-        return pos->second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
+        return entry.second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
     }
 
   private:
@@ -416,11 +548,11 @@ class EventBarrierHazardDetector {
           scope_pos_(event_scope.cbegin()),
           scope_end_(event_scope.cend()) {}
 
-    HazardResult Detect(const ResourceAccessRangeMap::const_iterator &pos) {
-        // Need to piece together coverage of pos->first range:
+    HazardResult Detect(const ResourceAccessRangeMap::value_type &entry) {
+        // Need to piece together coverage of entry.first range:
         // Copy the range as we'll be chopping it up as needed
-        ResourceAccessRange range = pos->first;
-        const ResourceAccessState &access = pos->second;
+        ResourceAccessRange range = entry.first;
+        const ResourceAccessState &access = entry.second;
         HazardResult hazard;
 
         bool in_scope = AdvanceScope(range);
@@ -449,10 +581,10 @@ class EventBarrierHazardDetector {
         return hazard;
     }
 
-    HazardResult DetectAsync(const ResourceAccessRangeMap::const_iterator &pos, ResourceUsageTag start_tag,
+    HazardResult DetectAsync(const ResourceAccessRangeMap::value_type &entry, ResourceUsageTag start_tag,
                              QueueId queue_id) const {
         // Async barrier hazard detection can use the same path as the usage index is not IsRead, but is IsWrite
-        return pos->second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
+        return entry.second.DetectAsyncHazard(usage_info_, start_tag, queue_id);
     }
 
   private:
@@ -529,9 +661,65 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAcc
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
+                                                 const AccessContext &access_context, vvl::ThreadPool *thread_pool) const {
+    // Below this many recorded entries per partition the task overhead is larger than the detection itself
+    constexpr size_t kMinEntriesPerPartition = 256;
+
+    const size_t entry_count = access_state_map_.size();
+    const size_t max_partitions = thread_pool ? (thread_pool->ThreadCount() + 1) : 1;  // The waiting thread runs partitions too
+    const size_t partition_count = std::min(max_partitions, entry_count / kMinEntriesPerPartition);
+    if (partition_count <= 1) {
+        return DetectFirstUseHazard(queue_id, tag_range, access_context, access_state_map_.cbegin(), access_state_map_.cend(), 0,
+                                    nullptr);
+    }
+
+    // The recorded entries cover disjoint address ranges and the detection only reads both contexts, so the partitions are
+    // independent. The queue context must not be modified until all of them are done.
+    std::vector<ResourceAccessRangeMap::const_iterator> bounds;
+    bounds.reserve(partition_count + 1);
+    const size_t entries_per_partition = (entry_count + partition_count - 1) / partition_count;
+    size_t entry_index = 0;
+    for (auto pos = access_state_map_.cbegin(); pos != access_state_map_.cend(); ++pos, ++entry_index) {
+        if (entry_index % entries_per_partition == 0) {
+            bounds.emplace_back(pos);
+        }
+    }
+    bounds.emplace_back(access_state_map_.cend());
+
+    // Index of the lowest partition with a hazard, the higher partitions can stop as their results won't be used
+    std::atomic<size_t> hazard_partition{bounds.size()};
+    std::vector<HazardResult> hazards(bounds.size() - 1);
+    vvl::ThreadPool::TaskGroup group;
+    for (size_t i = 0; i < hazards.size(); ++i) {
+        thread_pool->Submit(
+            "SyncVal first use hazard detection",
+            [this, &hazards, &bounds, &hazard_partition, &tag_range, &access_context, queue_id, i]() {
+                hazards[i] =
+                    DetectFirstUseHazard(queue_id, tag_range, access_context, bounds[i], bounds[i + 1], i, &hazard_partition);
+                if (hazards[i].IsHazard()) {
+                    size_t current = hazard_partition.load(std::memory_order_relaxed);
+                    while (i < current && !hazard_partition.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+                    }
+                }
+            },
+            &group);
+    }
+    thread_pool->Wait(group);
+
+    const size_t first_hazard = hazard_partition.load(std::memory_order_relaxed);
+    return (first_hazard < hazards.size()) ? std::move(hazards[first_hazard]) : HazardResult();
+}
+
+HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                                 const AccessContext &access_context, ResourceAccessRangeMap::const_iterator begin,
+                                                 ResourceAccessRangeMap::const_iterator end, size_t partition_index,
+                                                 const std::atomic<size_t> *stop_before) const {
     HazardResult hazard;
-    for (const auto &recorded_access : access_state_map_) {
+    std::optional<ResourceAccessRangeMap::value_type> scratch;
+    for (auto pos = begin; pos != end; ++pos) {
+        if (stop_before && stop_before->load(std::memory_order_relaxed) < partition_index) break;
+        // Pending layout transitions update the first access when resolved
+        const auto &recorded_access = CurrentEntry(*pos, scratch);
         // Cull any entries not in the current tag range
         if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
         HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
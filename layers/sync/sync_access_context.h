@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include "sync/sync_common.h"
 #include "sync/sync_access_state.h"
 
@@ -28,6 +29,7 @@ class VideoSession;
 class VideoPictureResource;
 class Bindable;
 class Event;
+class ThreadPool;
 }  // namespace vvl
 
 namespace syncval_state {
@@ -211,20 +213,29 @@ struct SubpassBarrierTrackback {
     const SubpassNode *source_subpass = nullptr;
     SubpassBarrierTrackback() = default;
     SubpassBarrierTrackback(const SubpassBarrierTrackback &) = default;
-    SubpassBarrierTrackback(const SubpassNode *source_subpass_, VkQueueFlags queue_flags_,
-                            const std::vector<const VkSubpassDependency2 *> &subpass_dependencies_)
-        : barriers(), source_subpass(source_subpass_) {
-        barriers.reserve(subpass_dependencies_.size());
-        for (const VkSubpassDependency2 *dependency : subpass_dependencies_) {
-            assert(dependency);
-            barriers.emplace_back(queue_flags_, *dependency);
-        }
-    }
+    SubpassBarrierTrackback(const SubpassNode *source_subpass_, const std::vector<SyncBarrier> &barriers_)
+        : barriers(barriers_), source_subpass(source_subpass_) {}
     SubpassBarrierTrackback(const SubpassNode *source_subpass_, const SyncBarrier &barrier_)
         : barriers(1, barrier_), source_subpass(source_subpass_) {}
     SubpassBarrierTrackback &operator=(const SubpassBarrierTrackback &) = default;
 };
 
+// The SyncBarriers of the dependencies of one subpass (see SubpassDependencyGraphNode), built once per render pass instead of
+// each time an AccessContext is set up for the subpass.
+struct SubpassBarriers {
+    struct Prev {
+        uint32_t subpass;
+        std::vector<SyncBarrier> barriers;
+    };
+    SubpassBarriers(VkQueueFlags queue_flags, const SubpassDependencyGraphNode &dependency);
+
+    uint32_t subpass;
+    std::vector<Prev> prev;
+    std::vector<uint32_t> async;
+    std::vector<SyncBarrier> from_external;
+    std::vector<SyncBarrier> to_external;
+};
+
 class AttachmentViewGen {
   public:
     enum Gen { kViewSubresource = 0, kRenderArea = 1, kDepthOnlyRenderArea = 2, kStencilOnlyRenderArea = 3, kGenSize = 4 };
@@ -272,6 +283,12 @@ class AccessContext {
     HazardResult DetectHazard(const ImageState &image, const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset,
                               const VkExtent3D &extent, bool is_depth_sliced, SyncStageAccessIndex current_usage,
                               SyncOrdering ordering_rule = SyncOrdering::kOrderingNone) const;
+    // Only the accesses made before tag_limit are seen, see ResourceAccessState::DetectHazardBeforeTag
+    HazardResult DetectHazardBeforeTag(const vvl::Buffer &buffer, SyncStageAccessIndex usage_index,
+                                       const ResourceAccessRange &range, ResourceUsageTag tag_limit) const;
+    HazardResult DetectHazardBeforeTag(const ImageViewState &image_view, const ImageRangeGen &range_gen,
+                                       SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
+                                       ResourceUsageTag tag_limit) const;
 
     HazardResult DetectImageBarrierHazard(const ImageState &image, const VkImageSubresourceRange &subresource_range,
                                           VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope,
@@ -284,8 +301,10 @@ class AccessContext {
                                           const VkImageSubresourceRange &subresource_range, DetectOptions options) const;
     HazardResult DetectSubpassTransitionHazard(const TrackBack &track_back, const AttachmentViewGen &attach_view) const;
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // When a thread pool is given, large contexts are split in address ordered partitions checked in parallel. The result
+    // is the same as the serial one: the hazard of the lowest address is reported.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      vvl::ThreadPool *thread_pool = nullptr) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -296,6 +315,8 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         access_state_map_.clear();
+        global_barriers_.clear();
+        global_barrier_seq_ = 0;
     }
 
     void ResolvePreviousAccesses();
@@ -336,16 +357,24 @@ class AccessContext {
     template <typename Action>
     void ApplyToContext(const Action &barrier_action);
 
-    AccessContext(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
-                  const std::vector<AccessContext> &contexts, const AccessContext *external_context);
+    AccessContext(const SubpassBarriers &subpass_barriers, const std::vector<AccessContext> &contexts,
+                  const AccessContext *external_context);
+    // Same as constructing the context, the storage of an already used one is reused
+    void InitSubpass(const SubpassBarriers &subpass_barriers, const std::vector<AccessContext> &contexts,
+                     const AccessContext *external_context);
 
     AccessContext() { Reset(); }
-    AccessContext(const AccessContext &copy_from) = default;
+    // Copies are snapshots (event first scopes, render pass replay...), they are made with the global barriers applied
+    AccessContext(const AccessContext &copy_from);
+    AccessContext &operator=(const AccessContext &) = default;
     void Trim();
     void TrimAndClearFirstAccess();
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
-    ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
+    ResourceAccessRangeMap &GetAccessStateMap() {
+        ApplyPendingGlobalBarriers();
+        return access_state_map_;
+    }
     const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
@@ -388,9 +417,43 @@ class AccessContext {
     template <typename Action, typename RangeGen>
     void UpdateMemoryAccessState(const Action &action, RangeGen &range_gen);
 
+    // Global memory barriers of a pipeline barrier are not applied to every access state when recorded, which would make each
+    // of them cost a walk of the whole map. They are queued instead, and each access state catches up with the batches
+    // recorded since it was last brought up to date when it is next updated, checked for hazards or resolved into another
+    // context. A batch also resolves the pending barriers the buffer and image barriers of the same command left.
+    void RecordGlobalBarriers(QueueId queue_id, const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag);
+    // Applies all the queued batches, for the operations that need the whole map up to date
+    void ApplyPendingGlobalBarriers();
+    bool HasPendingGlobalBarriers(const ResourceAccessState &access) const {
+        return !global_barriers_.empty() && (access.GlobalBarrierSeq() < global_barriers_.back().seq);
+    }
+    void ApplyPendingGlobalBarriers(ResourceAccessState &access) const;
+
   private:
     template <typename Action>
-    static void UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action, const ResourceAccessRange &range);
+    friend struct ActionToOpsAdapter;
+
+    template <typename Action>
+    void UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action, const ResourceAccessRange &range);
+
+    // The global barriers of one pipeline barrier command. seq numbers the batches of this context only, the GlobalBarrierSeq of a
+    // state is only meaningful in the map of the context that stamped it (see ResolveAccessRange).
+    struct GlobalBarrierBatch {
+        uint64_t seq;
+        QueueId queue_id;
+        ResourceUsageTag tag;
+        std::vector<SyncBarrier> barriers;
+    };
+    uint64_t CurrentGlobalBarrierSeq() const { return global_barrier_seq_; }
+
+    // Returns entry, or a copy of it with the pending global barriers applied
+    const ResourceAccessRangeMap::value_type &CurrentEntry(const ResourceAccessRangeMap::value_type &entry,
+                                                           std::optional<ResourceAccessRangeMap::value_type> &scratch) const {
+        if (!HasPendingGlobalBarriers(entry.second)) return entry;
+        scratch.emplace(entry);
+        ApplyPendingGlobalBarriers(scratch->second);
+        return *scratch;
+    }
 
     struct UpdateMemoryAccessStateFunctor {
         using Iterator = ResourceAccessRangeMap::iterator;
@@ -453,8 +516,16 @@ class AccessContext {
 
     template <typename Detector>
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
+    // Checks the entries [begin, end) of this (recorded) context. Stops early once stop_before is set to a partition index
+    // lower than partition_index.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      ResourceAccessRangeMap::const_iterator begin, ResourceAccessRangeMap::const_iterator end,
+                                      size_t partition_index, const std::atomic<size_t> *stop_before) const;
 
     ResourceAccessRangeMap access_state_map_;
+    std::vector<GlobalBarrierBatch> global_barriers_;
+    // seq of the last batch recorded in this context
+    uint64_t global_barrier_seq_ = 0;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
@@ -466,6 +537,7 @@ class AccessContext {
 
 // The semantics of the InfillUpdateOps of infill_update_range are slightly different than for the UpdateMemoryAccessState Action
 // operations, as this simplifies the generic traversal.  So we wrap them in a semantics Adapter to get the same effect.
+// The adapter also brings the states it visits up to date with the global barriers of the context before the action is applied.
 template <typename Action>
 struct ActionToOpsAdapter {
     using Map = ResourceAccessRangeMap;
@@ -480,12 +552,19 @@ struct ActionToOpsAdapter {
 
         // Need to apply the action to the Infill.  'infill_update_range' expect ops.infill to be completely done with
         // the infill_range, where as Action::Infill assumes the caller will apply the action() logic to the infill_range
+        // The infilled states were not in the map when the pending global barriers were recorded, so none of them apply.
+        const uint64_t current_seq = context.CurrentGlobalBarrierSeq();
         for (; infill != pos; ++infill) {
             assert(infill != accesses.end());
+            infill->second.SetGlobalBarrierSeq(current_seq);
             action(infill);
         }
     }
-    void update(const Iterator &pos) const { action(pos); }
+    void update(const Iterator &pos) const {
+        context.ApplyPendingGlobalBarriers(pos->second);
+        action(pos);
+    }
+    const AccessContext &context;
     const Action &action;
 };
 
@@ -493,18 +572,20 @@ template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
     UpdateMemoryAccessRangeState(access_state_map_, barrier_action, kFullRange);
+    // The walk brought every state up to date
+    global_barriers_.clear();
 }
 
 template <typename Action>
 void AccessContext::UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action,
                                                  const ResourceAccessRange &range) {
-    ActionToOpsAdapter<Action> ops{action};
+    ActionToOpsAdapter<Action> ops{*this, action};
     infill_update_range(accesses, range, ops);
 }
 
 template <typename Action, typename RangeGen>
 void AccessContext::UpdateMemoryAccessState(const Action &action, RangeGen &range_gen) {
-    ActionToOpsAdapter<Action> ops{action};
+    ActionToOpsAdapter<Action> ops{*this, action};
     infill_update_rangegen(access_state_map_, range_gen, ops);
 }
 
@@ -527,11 +608,15 @@ HazardResult AccessContext::DetectAsyncHazard(const Detector &detector, const Ra
 
     HazardResult hazard;
 
-    auto do_async_hazard_check = [&detector, async_tag, async_queue_id, &hazard](const RangeType &range, const ConstIterator &end,
-                                                                                 ConstIterator &pos) {
+    auto do_async_hazard_check = [this, &detector, async_tag, async_queue_id, &hazard](
+                                     const RangeType &range, const ConstIterator &end, ConstIterator &pos) {
+        std::optional<ResourceAccessRangeMap::value_type> scratch;
         while (pos != end && pos->first.begin < range.end) {
-            hazard = detector.DetectAsync(pos, async_tag, async_queue_id);
-            if (hazard.IsHazard()) return true;
+            hazard = detector.DetectAsync(CurrentEntry(*pos, scratch), async_tag, async_queue_id);
+            if (hazard.IsHazard()) {
+                hazard.SetAddress(std::max(pos->first.begin, range.begin));
+                return true;
+            }
             ++pos;
         }
         return false;
@@ -548,6 +633,7 @@ HazardResult AccessContext::DetectHazardOneRange(Detector &detector, bool detect
                                                  const ResourceAccessRange &range) const {
     HazardResult hazard;
     ResourceAccessRange gap = {range.begin, range.begin};
+    std::optional<ResourceAccessRangeMap::value_type> scratch;
 
     while (pos != the_end && pos->first.begin < range.end) {
         // Cover any leading gap, or gap between entries
@@ -564,8 +650,11 @@ HazardResult AccessContext::DetectHazardOneRange(Detector &detector, bool detect
             gap.begin = pos->first.end;
         }
 
-        hazard = detector.Detect(pos);
-        if (hazard.IsHazard()) return hazard;
+        hazard = detector.Detect(CurrentEntry(*pos, scratch));
+        if (hazard.IsHazard()) {
+            hazard.SetAddress(std::max(pos->first.begin, range.begin));
+            return hazard;
+        }
         ++pos;
     }
 
@@ -598,6 +687,10 @@ void AccessContext::ResolveAccessRange(const ResourceAccessRange &range, Barrier
         if (current->pos_B->valid) {
             const auto &src_pos = current->pos_B->lower_bound;
             ResourceAccessState access(src_pos->second);  // intentional copy
+            ApplyPendingGlobalBarriers(access);
+            // The seq is relative to this context. The resolve_map has no pending batches (callers apply them first, or restamp
+            // infilled states), so a state that is new to it must see all the batches recorded there from now on.
+            access.SetGlobalBarrierSeq(0);
             barrier_action(&access);
             if (current->pos_A->valid) {
                 const auto trimmed = sparse_container::split(current->pos_A->lower_bound, *resolve_map, current_range);
@@ -687,14 +780,19 @@ HazardResult AccessContext::DetectPreviousHazard(Detector &detector, const Resou
     ResolvePreviousAccess(range, &descent_map, nullptr);
 
     HazardResult hazard;
-    for (auto prev = descent_map.begin(); prev != descent_map.end() && !hazard.IsHazard(); ++prev) {
-        hazard = detector.Detect(prev);
+    for (auto prev = descent_map.begin(); prev != descent_map.end(); ++prev) {
+        hazard = detector.Detect(*prev);
+        if (hazard.IsHazard()) {
+            hazard.SetAddress(prev->first.begin);
+            break;
+        }
     }
     return hazard;
 }
 
 template <typename Predicate>
 void AccessContext::EraseIf(Predicate &&pred) {
+    ApplyPendingGlobalBarriers();
     // Note: Don't forward, we don't want r-values moved, since we're going to make multiple calls.
     vvl::EraseIf(access_state_map_, pred);
 }
@@ -702,12 +800,14 @@ void AccessContext::EraseIf(Predicate &&pred) {
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    ApplyPendingGlobalBarriers();
     from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
 }
 
 template <typename ResolveOp, typename RangeGenerator>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, RangeGenerator range_gen,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    ApplyPendingGlobalBarriers();
     for (; range_gen->non_empty(); ++range_gen) {
         from_context.ResolveAccessRange(*range_gen, resolve_op, &access_state_map_, infill_state, recur_to_infill);
     }
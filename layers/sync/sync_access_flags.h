@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Fixed size bit set used for the SyncStageAccessFlags.
+//
+// Covers the part of the std::bitset interface used by sync validation. Every operation is a fixed count loop over 64 bit
+// words, positions are only checked by assert, and everything is constexpr so the generated per stage/access masks are
+// compile time constants instead of being initialized at startup in every translation unit.
+template <size_t kBitCount>
+class SyncAccessBitset {
+  public:
+    static constexpr size_t kWordBits = 64;
+    static constexpr size_t kWordCount = (kBitCount + kWordBits - 1) / kWordBits;
+    static_assert(kBitCount % kWordBits == 0, "Only whole words are supported, no masking of the last word is done");
+
+    constexpr SyncAccessBitset() : words_{} {}
+    // Same meaning as the std::bitset constructor, sets the low 64 bits
+    constexpr SyncAccessBitset(unsigned long long value) : words_{} { words_[0] = value; }
+
+    static constexpr SyncAccessBitset Bit(size_t pos) {
+        SyncAccessBitset result;
+        result.words_[pos / kWordBits] = uint64_t(1) << (pos % kWordBits);
+        return result;
+    }
+
+    static constexpr size_t size() { return kBitCount; }
+
+    constexpr bool test(size_t pos) const {
+        assert(pos < kBitCount);
+        return (words_[pos / kWordBits] >> (pos % kWordBits)) & 1;
+    }
+    constexpr bool operator[](size_t pos) const { return test(pos); }
+
+    constexpr SyncAccessBitset &set() {
+        for (size_t i = 0; i < kWordCount; ++i) words_[i] = ~uint64_t(0);
+        return *this;
+    }
+    constexpr SyncAccessBitset &set(size_t pos, bool value = true) {
+        assert(pos < kBitCount);
+        const uint64_t bit = uint64_t(1) << (pos % kWordBits);
+        words_[pos / kWordBits] = value ? (words_[pos / kWordBits] | bit) : (words_[pos / kWordBits] & ~bit);
+        return *this;
+    }
+    constexpr SyncAccessBitset &reset() {
+        for (size_t i = 0; i < kWordCount; ++i) words_[i] = 0;
+        return *this;
+    }
+    constexpr SyncAccessBitset &reset(size_t pos) { return set(pos, false); }
+
+    constexpr bool any() const {
+        uint64_t combined = 0;
+        for (size_t i = 0; i < kWordCount; ++i) combined |= words_[i];
+        return combined != 0;
+    }
+    constexpr bool none() const { return !any(); }
+    constexpr bool all() const {
+        uint64_t combined = ~uint64_t(0);
+        for (size_t i = 0; i < kWordCount; ++i) combined &= words_[i];
+        return combined == ~uint64_t(0);
+    }
+    size_t count() const {
+        size_t result = 0;
+        for (size_t i = 0; i < kWordCount; ++i) result += PopCount(words_[i]);
+        return result;
+    }
+    // True if the two sets share at least one bit, same as (*this & other).any() without building the intersection
+    constexpr bool intersects(const SyncAccessBitset &other) const {
+        uint64_t combined = 0;
+        for (size_t i = 0; i < kWordCount; ++i) combined |= words_[i] & other.words_[i];
+        return combined != 0;
+    }
+    // Index of the lowest set bit, size() when none is set
+    size_t find_first() const {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            if (words_[i]) return i * kWordBits + LowestSetBit(words_[i]);
+        }
+        return kBitCount;
+    }
+
+    constexpr SyncAccessBitset &operator&=(const SyncAccessBitset &other) {
+        for (size_t i = 0; i < kWordCount; ++i) words_[i] &= other.words_[i];
+        return *this;
+    }
+    constexpr SyncAccessBitset &operator|=(const SyncAccessBitset &other) {
+        for (size_t i = 0; i < kWordCount; ++i) words_[i] |= other.words_[i];
+        return *this;
+    }
+    constexpr SyncAccessBitset &operator^=(const SyncAccessBitset &other) {
+        for (size_t i = 0; i < kWordCount; ++i) words_[i] ^= other.words_[i];
+        return *this;
+    }
+    constexpr SyncAccessBitset operator~() const {
+        SyncAccessBitset result;
+        for (size_t i = 0; i < kWordCount; ++i) result.words_[i] = ~words_[i];
+        return result;
+    }
+    constexpr SyncAccessBitset operator<<(size_t shift) const {
+        SyncAccessBitset result;
+        if (shift >= kBitCount) return result;
+        const size_t word_shift = shift / kWordBits;
+        const size_t bit_shift = shift % kWordBits;
+        for (size_t i = kWordCount; i-- > word_shift;) {
+            uint64_t word = words_[i - word_shift] << bit_shift;
+            if (bit_shift != 0 && i > word_shift) {
+                word |= words_[i - word_shift - 1] >> (kWordBits - bit_shift);
+            }
+            result.words_[i] = word;
+        }
+        return result;
+    }
+
+    friend constexpr SyncAccessBitset operator&(const SyncAccessBitset &lhs, const SyncAccessBitset &rhs) {
+        SyncAccessBitset result(lhs);
+        return result &= rhs;
+    }
+    friend constexpr SyncAccessBitset operator|(const SyncAccessBitset &lhs, const SyncAccessBitset &rhs) {
+        SyncAccessBitset result(lhs);
+        return result |= rhs;
+    }
+    friend constexpr SyncAccessBitset operator^(const SyncAccessBitset &lhs, const SyncAccessBitset &rhs) {
+        SyncAccessBitset result(lhs);
+        return result ^= rhs;
+    }
+    friend constexpr bool operator==(const SyncAccessBitset &lhs, const SyncAccessBitset &rhs) {
+        uint64_t diff = 0;
+        for (size_t i = 0; i < kWordCount; ++i) diff |= lhs.words_[i] ^ rhs.words_[i];
+        return diff == 0;
+    }
+    friend constexpr bool operator!=(const SyncAccessBitset &lhs, const SyncAccessBitset &rhs) { return !(lhs == rhs); }
+
+    // Calls func(index) for each set bit, in increasing order
+    template <typename Func>
+    void ForEachSetBit(Func &&func) const {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            for (uint64_t word = words_[i]; word != 0; word &= word - 1) {
+                func(i * kWordBits + LowestSetBit(word));
+            }
+        }
+    }
+
+    // Input must not be 0
+    static inline uint32_t LowestSetBit(uint64_t word) {
+        assert(word != 0);
+#if defined(__GNUC__)
+        return static_cast<uint32_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long bit_pos;
+        _BitScanForward64(&bit_pos, word);
+        return static_cast<uint32_t>(bit_pos);
+#else
+        uint32_t bit_pos = 0;
+        while ((word & 1) == 0) {
+            word >>= 1;
+            ++bit_pos;
+        }
+        return bit_pos;
+#endif
+    }
+
+    static inline uint32_t PopCount(uint64_t word) {
+#if defined(__GNUC__)
+        return static_cast<uint32_t>(__builtin_popcountll(word));
+#else
+        // SWAR population count
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<uint32_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+  private:
+    uint64_t words_[kWordCount];
+};
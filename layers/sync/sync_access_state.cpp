@@ -114,7 +114,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         return DetectBarrierHazard(usage_info, queue_id, ordering.exec_scope, ordering.access_scope);
     } else {
         // Only check for WAW if there are no reads since last_write
-        const bool usage_write_is_ordered = (usage_bit & ordering.access_scope).any();
+        const bool usage_write_is_ordered = usage_bit.intersects(ordering.access_scope);
         if (last_reads.size()) {
             // Look for any WAR hazards outside the ordered set of stages
             VkPipelineStageFlags2KHR ordered_stages = VK_PIPELINE_STAGE_2_NONE;
@@ -137,7 +137,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
             if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (last_write->IsIndex(SYNC_IMAGE_LAYOUT_TRANSITION))) {
                 // ILT after ILT is a special case where we check the 2nd access scope of the first ILT against the first access
                 // scope of the second ILT, which has been passed (smuggled?) in the ordering barrier
-                ilt_ilt_hazard = !(last_write->Barriers() & ordering.access_scope).any();
+                ilt_ilt_hazard = !last_write->Barriers().intersects(ordering.access_scope);
             }
             if (ilt_ilt_hazard || last_write->IsWriteHazard(usage_info)) {
                 hazard.Set(this, usage_info, WRITE_AFTER_WRITE, *last_write);
@@ -147,6 +147,33 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
     return hazard;
 }
 
+HazardResult ResourceAccessState::DetectHazardBeforeTag(const SyncStageAccessInfoType &usage_info, SyncOrdering ordering_rule,
+                                                        ResourceUsageTag tag_limit) const {
+    if (last_write.has_value() && last_write->Tag() >= tag_limit) {
+        // The reads are all more recent than the write
+        return HazardResult();
+    }
+    bool reads_in_limit = true;
+    for (const auto &read_access : last_reads) {
+        reads_in_limit &= (read_access.tag < tag_limit);
+    }
+    if (reads_in_limit) {
+        return DetectHazard(usage_info, ordering_rule, kQueueIdInvalid);
+    }
+
+    ResourceAccessState limited(*this);
+    limited.last_reads.clear();
+    limited.last_read_stages = VK_PIPELINE_STAGE_2_NONE;
+    limited.input_attachment_read = false;
+    for (const auto &read_access : last_reads) {
+        if (read_access.tag >= tag_limit) continue;
+        limited.last_reads.emplace_back(read_access);
+        limited.last_read_stages |= read_access.stage;
+        limited.input_attachment_read |= (read_access.access == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
+    }
+    return limited.DetectHazard(usage_info, ordering_rule, kQueueIdInvalid);
+}
+
 HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &recorded_use, QueueId queue_id,
                                                const ResourceUsageRange &tag_range) const {
     HazardResult hazard;
@@ -513,6 +540,16 @@ void HazardResult::AddRecordedAccess(const ResourceFirstAccess &first_access) {
     assert(state_.has_value());
     state_->recorded_access = std::make_unique<const ResourceFirstAccess>(first_access);
 }
+void HazardResult::SetAddress(ResourceAddress address) {
+    assert(state_.has_value());
+    state_->address = address;
+}
+
+void HazardResult::SetImageSubresource(const VkImageSubresource &subresource) {
+    assert(state_.has_value());
+    state_->subresource = subresource;
+}
+
 bool HazardResult::IsWAWHazard() const {
     assert(state_.has_value());
     return (state_->hazard == WRITE_AFTER_WRITE) && (state_->prior_access[state_->usage_index]);
@@ -664,14 +701,15 @@ ResourceAccessState::ResourceAccessState()
       first_accesses_(),
       first_read_stages_(VK_PIPELINE_STAGE_2_NONE),
       first_write_layout_ordering_(),
-      first_access_closed_(false) {}
+      first_access_closed_(false),
+      global_barrier_seq_(0) {}
 
 // This should be just Bits or Index, but we don't have an invalid state for Index
 VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = VK_PIPELINE_STAGE_2_NONE;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if (read_access.access.intersects(usage_bit)) {
             barriers = read_access.barriers;
             break;
         }
@@ -695,7 +733,7 @@ bool ResourceAccessState::IsWriteBarrierHazard(QueueId queue_id, VkPipelineStage
 }
 
 bool ResourceAccessState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
-                                                    SyncStageAccessFlags src_access_scope) const {
+                                                    const SyncStageAccessFlags &src_access_scope) const {
     return last_write.has_value() && last_write->WriteInSourceScopeOrChain(src_exec_scope, src_access_scope);
 }
 
@@ -933,7 +971,7 @@ bool ResourceAccessWriteState::WriteInScope(const SyncStageAccessFlags &src_acce
 }
 
 bool ResourceAccessWriteState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
-                                                         SyncStageAccessFlags src_access_scope) const {
+                                                         const SyncStageAccessFlags &src_access_scope) const {
     assert(access_);
     return WriteInChain(src_exec_scope) || WriteInScope(src_access_scope);
 }
@@ -74,6 +74,10 @@ class HazardResult {
         SyncStageAccessFlags prior_access;
         ResourceUsageTag tag = ResourceUsageTag();
         SyncHazard hazard = NONE;
+        // First hazardous address, set by the range walkers only once a hazard is found
+        ResourceAddress address = 0;
+        // Image subresource at address, decoded only for hazards detected against an image
+        std::optional<VkImageSubresource> subresource;
         HazardState(const ResourceAccessState *access_state_, const SyncStageAccessInfoType &usage_info_, SyncHazard hazard_,
                     const SyncStageAccessFlags &prior_, ResourceUsageTag tag_);
     };
@@ -83,6 +87,8 @@ class HazardResult {
     void Set(const ResourceAccessState *access_state_, const SyncStageAccessInfoType &usage_info_, SyncHazard hazard_,
              const SyncStageAccessFlags &prior_, ResourceUsageTag tag_);
     void AddRecordedAccess(const ResourceFirstAccess &first_access);
+    void SetAddress(ResourceAddress address);
+    void SetImageSubresource(const VkImageSubresource &subresource);
 
     bool IsHazard() const { return state_.has_value() && NONE != state_->hazard; }
     bool IsWAWHazard() const;
@@ -208,7 +214,7 @@ class ResourceAccessWriteState {
     }
     bool WriteInChain(VkPipelineStageFlags2KHR src_exec_scope) const;
     bool WriteInScope(const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
 
@@ -338,6 +344,10 @@ class ResourceAccessState : public SyncStageAccess {
     HazardResult DetectHazard(const SyncStageAccessInfoType &usage_info, SyncOrdering ordering_rule, QueueId queue_id) const;
     HazardResult DetectHazard(const SyncStageAccessInfoType &usage_info, const OrderingBarrier &ordering, QueueId queue_id) const;
     HazardResult DetectHazard(const ResourceAccessState &recorded_use, QueueId queue_id, const ResourceUsageRange &tag_range) const;
+    // Only the accesses made before tag_limit are seen. As only the most recent write is kept, a write followed by another one
+    // at or after tag_limit is not seen either.
+    HazardResult DetectHazardBeforeTag(const SyncStageAccessInfoType &usage_info, SyncOrdering ordering_rule,
+                                       ResourceUsageTag tag_limit) const;
 
     HazardResult DetectAsyncHazard(const SyncStageAccessInfoType &usage_info, ResourceUsageTag start_tag, QueueId queue_id) const;
     HazardResult DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
@@ -421,7 +431,7 @@ class ResourceAccessState : public SyncStageAccess {
 
     bool IsWriteBarrierHazard(QueueId queue_id, VkPipelineStageFlags2KHR src_exec_scope,
                               const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInEventScope(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope,
@@ -462,6 +472,11 @@ class ResourceAccessState : public SyncStageAccess {
     void Normalize();
     void GatherReferencedTags(ResourceUsageTagSet &used) const;
 
+    // Sequence number of the last global barrier batch applied to this state, see AccessContext::RecordGlobalBarriers.
+    // Not part of the state proper, and not compared by operator==.
+    uint64_t GlobalBarrierSeq() const { return global_barrier_seq_; }
+    void SetGlobalBarrierSeq(uint64_t seq) { global_barrier_seq_ = seq; }
+
   private:
     static constexpr VkPipelineStageFlags2KHR kInvalidAttachmentStage = ~VkPipelineStageFlags2KHR(0);
     bool IsRAWHazard(const SyncStageAccessInfoType &usage_info) const;
@@ -519,6 +534,8 @@ class ResourceAccessState : public SyncStageAccess {
     OrderingBarrier first_write_layout_ordering_;
     bool first_access_closed_;
 
+    uint64_t global_barrier_seq_;
+
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
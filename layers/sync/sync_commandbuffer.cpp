@@ -19,6 +19,7 @@
 #include "sync/sync_op.h"
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
+#include "generated/layer_chassis_dispatch.h"
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/buffer_state.h"
@@ -68,6 +69,60 @@ ResourceUsageRange CommandExecutionContext::ImportRecordedAccessLog(const Comman
     return tag_range;
 }
 
+static bool IsBeginRenderPassCommand(vvl::Func command) {
+    return command == vvl::Func::vkCmdBeginRenderPass || command == vvl::Func::vkCmdBeginRenderPass2 ||
+           command == vvl::Func::vkCmdBeginRenderPass2KHR;
+}
+
+static bool IsBeginRenderingCommand(vvl::Func command) {
+    return command == vvl::Func::vkCmdBeginRendering || command == vvl::Func::vkCmdBeginRenderingKHR;
+}
+
+static bool IsNextSubpassCommand(vvl::Func command) {
+    return command == vvl::Func::vkCmdNextSubpass || command == vvl::Func::vkCmdNextSubpass2 ||
+           command == vvl::Func::vkCmdNextSubpass2KHR;
+}
+
+static bool IsEndRenderPassCommand(vvl::Func command) {
+    return command == vvl::Func::vkCmdEndRenderPass || command == vvl::Func::vkCmdEndRenderPass2 ||
+           command == vvl::Func::vkCmdEndRenderPass2KHR || command == vvl::Func::vkCmdEndRendering ||
+           command == vvl::Func::vkCmdEndRenderingKHR;
+}
+
+ResourceUsageRecordContext CommandExecutionContext::GetUsageRecordContext(const AccessLog &log, size_t index) {
+    ResourceUsageRecordContext context;
+    assert(index < log.size());
+    const ResourceUsageRecord &record = log[index];
+    if (record.alt_usage || !record.cb_state) return context;
+
+    // Only the records of the same command buffer recording are relevant, the log of a primary command buffer also holds the
+    // records of the executed secondary command buffers
+    uint32_t next_subpass_count = 0;
+    for (size_t i = index + 1; i-- > 0;) {
+        const ResourceUsageRecord &prev = log[i];
+        if (prev.cb_state != record.cb_state || prev.reset_count != record.reset_count || prev.sub_command != 0) continue;
+
+        if (prev.seq_num == record.seq_num) {
+            if (i != index) {
+                context.command_record = &prev;
+            }
+        } else if (IsEndRenderPassCommand(prev.command)) {
+            break;  // Not recorded in a render pass instance
+        }
+
+        if (IsNextSubpassCommand(prev.command)) {
+            ++next_subpass_count;
+        } else if (IsBeginRenderPassCommand(prev.command) || IsBeginRenderingCommand(prev.command)) {
+            context.render_pass_command = record.seq_num - prev.seq_num;
+            if (IsBeginRenderPassCommand(prev.command)) {
+                context.subpass = next_subpass_count;
+            }
+            break;
+        }
+    }
+    return context;
+}
+
 bool CommandExecutionContext::ValidForSyncOps() const {
     const bool valid = GetCurrentEventsContext() && GetCurrentAccessContext();
     assert(valid);
@@ -86,6 +141,7 @@ CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator *sync
       current_context_(&cb_access_context_),
       events_context_(),
       render_pass_contexts_(),
+      render_pass_context_pool_(),
       current_renderpass_context_(),
       sync_ops_() {}
 
@@ -119,11 +175,16 @@ void CommandBufferAccessContext::Reset() {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
     sync_ops_.clear();
+    descriptor_footprints_.clear();
+    descriptor_buffer_accesses_.clear();
     command_number_ = 0;
     subcommand_number_ = 0;
     reset_count_++;
-    command_handles_.clear();
     cb_access_context_.Reset();
+    for (auto &rp_context : render_pass_contexts_) {
+        rp_context->Reset();
+        render_pass_context_pool_.emplace_back(std::move(rp_context));
+    }
     render_pass_contexts_.clear();
     current_context_ = &cb_access_context_;
     current_renderpass_context_ = nullptr;
@@ -138,7 +199,8 @@ std::string CommandBufferAccessContext::FormatUsage(const ResourceUsageTag tag)
     assert(tag < access_log_->size());
     const auto &record = (*access_log_)[tag];
     const auto debug_name_provider = (record.label_command_index == vvl::kU32Max) ? nullptr : this;
-    out << record.Formatter(*sync_state_, cb_state_, debug_name_provider);
+    const ResourceUsageRecordContext context = GetUsageRecordContext(*access_log_, tag);
+    out << record.Formatter(*sync_state_, cb_state_, debug_name_provider, &context);
     return out.str();
 }
 
@@ -286,14 +348,47 @@ void CommandBufferAccessContext::RecordEndRendering(const RecordObject &record_o
     dynamic_rendering_info_.reset();
 }
 
-bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
-                                                                   const Location &loc) const {
-    bool skip = false;
-    const vvl::Pipeline *pipe = nullptr;
-    const std::vector<LastBound::PER_SET> *per_sets = nullptr;
-    cb_state_->GetCurrentPipelineAndDesriptorSets(pipelineBindPoint, &pipe, &per_sets);
-    if (!pipe || !per_sets) {
-        return skip;
+// Address of the data of a set bound from a descriptor buffer, 0 when the set is not bound from one
+static VkDeviceAddress GetDescriptorBufferSetAddress(const vvl::CommandBuffer &cb_state, const LastBound::PER_SET &per_set) {
+    if (!per_set.bound_descriptor_buffer) {
+        return 0;
+    }
+    const LastBound::DescriptorBufferBinding &binding = *per_set.bound_descriptor_buffer;
+    if (binding.index >= cb_state.descriptor_buffer_binding_info.size()) {
+        return 0;
+    }
+    return cb_state.descriptor_buffer_binding_info[binding.index].address + binding.offset;
+}
+
+bool CommandBufferAccessContext::DescriptorAccessFootprint::Access::Invalid() const { return descriptor->Invalid(); }
+
+VkImageLayout CommandBufferAccessContext::DescriptorAccessFootprint::Access::GetImageLayout() const {
+    return static_cast<const vvl::ImageDescriptor *>(descriptor)->GetImageLayout();
+}
+
+bool CommandBufferAccessContext::DescriptorAccessFootprint::IsCurrent(const std::vector<LastBound::PER_SET> &per_sets,
+                                                                      const vvl::CommandBuffer &cb_state) const {
+    for (uint32_t set_index = 0; set_index < sets.size(); ++set_index) {
+        const SetVersion &version = sets[set_index];
+        if (!version.used) continue;
+        const LastBound::PER_SET *per_set = (set_index < per_sets.size()) ? &per_sets[set_index] : nullptr;
+        const vvl::DescriptorSet *bound_set = per_set ? per_set->bound_descriptor_set.get() : nullptr;
+        if (bound_set != version.set.get() || (bound_set && bound_set->GetChangeCount() != version.change_count)) {
+            return false;
+        }
+        const VkDeviceAddress descriptor_buffer_address = per_set ? GetDescriptorBufferSetAddress(cb_state, *per_set) : 0;
+        if (descriptor_buffer_address != version.descriptor_buffer_address) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const CommandBufferAccessContext::DescriptorAccessFootprint &CommandBufferAccessContext::GetDescriptorAccessFootprint(
+    const vvl::Pipeline &pipe, const std::vector<LastBound::PER_SET> &per_sets) const {
+    DescriptorAccessFootprint &footprint = descriptor_footprints_[&pipe];
+    if (footprint.pipeline && footprint.IsCurrent(per_sets, *cb_state_)) {
+        return footprint;
     }
 
     using DescriptorClass = vvl::DescriptorClass;
@@ -301,19 +396,62 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        const auto raster_state = pipe->RasterizationState();
+    footprint.pipeline = std::static_pointer_cast<const vvl::Pipeline>(pipe.shared_from_this());
+    footprint.sets.clear();
+    footprint.accesses.clear();
+    footprint.descriptor_buffer_bindings.clear();
+    const auto pipeline_layout = pipe.PipelineLayoutState();
+
+    for (const auto &stage_state : pipe.stage_states) {
+        const auto raster_state = pipe.RasterizationState();
         if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && raster_state && raster_state->rasterizerDiscardEnable) {
             continue;
         } else if (!stage_state.entrypoint) {
             continue;
         }
         for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
+            const uint32_t set_index = variable.decorations.set;
+            if (set_index >= footprint.sets.size()) {
+                footprint.sets.resize(set_index + 1);
+            }
+            auto &set_version = footprint.sets[set_index];
+            if (!set_version.used) {
+                set_version.used = true;
+                if (set_index < per_sets.size() && per_sets[set_index].bound_descriptor_set) {
+                    set_version.set = per_sets[set_index].bound_descriptor_set;
+                    set_version.change_count = set_version.set->GetChangeCount();
+                } else if (set_index < per_sets.size() && pipeline_layout) {
+                    set_version.descriptor_buffer_address = GetDescriptorBufferSetAddress(*cb_state_, per_sets[set_index]);
+                    if (set_version.descriptor_buffer_address != 0) {
+                        set_version.layout = pipeline_layout->GetDsl(set_index);
+                    }
+                }
+            }
+
+            if (set_version.layout) {
+                // Descriptor buffer, only the address of the descriptor data is known until submit time
+                const vvl::DescriptorSetLayout &layout = *set_version.layout;
+                const uint32_t binding = variable.decorations.binding;
+                // Same descriptor array workaround as for the descriptor sets below
+                if (!layout.HasBinding(binding) || layout.GetDescriptorCountFromBinding(binding) != 1) {
+                    continue;
+                }
+                const VkDescriptorType descriptor_type = layout.GetTypeFromBinding(binding);
+                VkDeviceSize binding_offset = 0;
+                DispatchGetDescriptorSetLayoutBindingOffsetEXT(sync_state_->device, layout.VkHandle(), binding, &binding_offset);
+                DescriptorAccessFootprint::DescriptorBufferBinding &buffer_binding =
+                    footprint.descriptor_buffer_bindings.emplace_back();
+                buffer_binding.address = set_version.descriptor_buffer_address + binding_offset;
+                buffer_binding.descriptor_type = descriptor_type;
+                buffer_binding.sync_index =
+                    GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
+                buffer_binding.set = set_index;
+                buffer_binding.binding = binding;
                 continue;
             }
-            const auto *descriptor_set = (*per_sets)[variable.decorations.set].bound_descriptor_set.get();
+
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
+            const auto *descriptor_set = set_version.set.get();
             if (!descriptor_set) continue;
             auto binding = descriptor_set->GetBinding(variable.decorations.binding);
             const auto descriptor_type = binding->type;
@@ -331,202 +469,164 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             }
 
             for (uint32_t index = 0; index < binding->count; index++) {
+                // Invalid descriptors are kept: a sparse resource becomes valid again once fully bound, without any update.
+                // Accesses are checked for validity when they are validated or recorded.
                 const auto *descriptor = binding->GetDescriptor(index);
+                DescriptorAccessFootprint::Access access{};
+                access.descriptor = descriptor;
+                access.descriptor_set = descriptor_set;
+                access.sync_index = sync_index;
+                access.descriptor_type = descriptor_type;
+                access.set = set_index;
+                access.binding = variable.decorations.binding;
+                access.index = index;
                 switch (descriptor->GetClass()) {
                     case DescriptorClass::ImageSampler:
                     case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
-                            continue;
-                        }
-
                         // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
                         const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
                         const auto *img_view_state =
                             static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        VkImageLayout image_layout = image_descriptor->GetImageLayout();
-
+                        // Null descriptor
+                        if (!img_view_state) {
+                            continue;
+                        }
                         if (img_view_state->IsDepthSliced()) {
                             // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
                             // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
                             // See: VUID 00343
                             continue;
                         }
-
-                        HazardResult hazard;
-
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            // Input attachments are subject to raster ordering rules
-                            hazard =
-                                current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
-                        } else {
-                            hazard = current_context_->DetectHazard(*img_view_state, sync_index);
-                        }
-
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
-                                "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                variable.decorations.binding, index, FormatHazard(hazard).c_str());
-                        }
+                        access.image_view = img_view_state;
                         break;
                     }
                     case DescriptorClass::TexelBuffer: {
                         const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
+                        access.buffer_view = texel_descriptor->GetBufferViewState();
+                        if (!access.buffer_view || !access.buffer_view->buffer_state) {
                             continue;
                         }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
-                        }
+                        access.buffer = access.buffer_view->buffer_state.get();
+                        access.range = MakeRange(*access.buffer_view);
                         break;
                     }
                     case DescriptorClass::GeneralBuffer: {
                         const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
+                        access.buffer = buffer_descriptor->GetBufferState();
+                        if (!access.buffer) {
                             continue;
                         }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
-                        }
+                        access.range = MakeRange(*access.buffer, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
                         break;
                     }
                     // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
                     default:
-                        break;
+                        continue;
                 }
+                footprint.accesses.emplace_back(access);
             }
         }
     }
-    return skip;
+    return footprint;
 }
 
-void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
-                                                                 const ResourceUsageTag tag) {
+bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
+                                                                   const Location &loc) const {
+    bool skip = false;
     const vvl::Pipeline *pipe = nullptr;
     const std::vector<LastBound::PER_SET> *per_sets = nullptr;
     cb_state_->GetCurrentPipelineAndDesriptorSets(pipelineBindPoint, &pipe, &per_sets);
     if (!pipe || !per_sets) {
-        return;
+        return skip;
     }
 
-    using DescriptorClass = vvl::DescriptorClass;
-    using BufferDescriptor = vvl::BufferDescriptor;
-    using ImageDescriptor = vvl::ImageDescriptor;
-    using TexelDescriptor = vvl::TexelDescriptor;
-
-    for (const auto &stage_state : pipe->stage_states) {
-        const auto raster_state = pipe->RasterizationState();
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && raster_state && raster_state->rasterizerDiscardEnable) {
-            continue;
-        } else if (!stage_state.entrypoint) {
+    const DescriptorAccessFootprint &footprint = GetDescriptorAccessFootprint(*pipe, *per_sets);
+    for (const auto &access : footprint.accesses) {
+        // The resource can have been destroyed, or a sparse resource can be partially bound, at this point
+        if (access.Invalid()) {
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
+        if (access.image_view) {
+            const auto *img_view_state = access.image_view;
+            HazardResult hazard;
+            if (access.sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                // Input attachments are subject to raster ordering rules
+                hazard = current_context_->DetectHazard(*img_view_state, offset, extent, access.sync_index, SyncOrdering::kRaster);
+            } else {
+                hazard = current_context_->DetectHazard(*img_view_state, access.sync_index);
             }
-            const auto *descriptor_set = (*per_sets)[variable.decorations.set].bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
 
-            // Do not update state for descriptor array (the same as in Validate function).
-            if (binding->count > 1) {
-                continue;
+            if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                const VkImageLayout image_layout = access.GetImageLayout();
+                skip |= sync_state_->LogError(
+                    string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
+                    "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32 ", index %" PRIu32
+                    ". Access info %s.",
+                    string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
+                    sync_state_->FormatHandle(cb_state_->Handle()).c_str(), sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                    sync_state_->FormatHandle(access.descriptor_set->Handle()).c_str(),
+                    string_VkDescriptorType(access.descriptor_type), string_VkImageLayout(image_layout), access.binding,
+                    access.index, FormatHazard(hazard).c_str());
             }
+        } else {
+            auto hazard = current_context_->DetectHazard(*access.buffer, access.sync_index, access.range);
+            if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                const VulkanTypedHandle resource_handle =
+                    access.buffer_view ? access.buffer_view->Handle() : access.buffer->Handle();
+                skip |= sync_state_->LogError(
+                    string_SyncHazardVUID(hazard.Hazard()), resource_handle, loc,
+                    "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                    string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(resource_handle).c_str(),
+                    sync_state_->FormatHandle(cb_state_->Handle()).c_str(), sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                    sync_state_->FormatHandle(access.descriptor_set->Handle()).c_str(),
+                    string_VkDescriptorType(access.descriptor_type), access.binding, access.index, FormatHazard(hazard).c_str());
+            }
+        }
+    }
+    return skip;
+}
 
-            for (uint32_t i = 0; i < binding->count; i++) {
-                const auto *descriptor = binding->GetDescriptor(i);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
-                                                                tag);
-                        } else {
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
-                        }
-                        break;
-                    }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag);
-                        break;
-                    }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag);
-                        break;
-                    }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
-                }
+void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
+                                                                 const ResourceUsageTag tag) {
+    const vvl::Pipeline *pipe = nullptr;
+    const std::vector<LastBound::PER_SET> *per_sets = nullptr;
+    cb_state_->GetCurrentPipelineAndDesriptorSets(pipelineBindPoint, &pipe, &per_sets);
+    if (!pipe || !per_sets) {
+        return;
+    }
+
+    const DescriptorAccessFootprint &footprint = GetDescriptorAccessFootprint(*pipe, *per_sets);
+    for (const auto &access : footprint.accesses) {
+        if (access.Invalid()) {
+            continue;
+        }
+        if (access.image_view) {
+            if (access.sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                current_context_->UpdateAccessState(*access.image_view, access.sync_index, SyncOrdering::kRaster, offset, extent,
+                                                    tag);
+            } else {
+                current_context_->UpdateAccessState(*access.image_view, access.sync_index, SyncOrdering::kNonAttachment, tag);
             }
+        } else {
+            current_context_->UpdateAccessState(*access.buffer, access.sync_index, SyncOrdering::kNonAttachment, access.range,
+                                                tag);
         }
     }
+    for (const auto &buffer_binding : footprint.descriptor_buffer_bindings) {
+        SyncDescriptorBufferAccess &access = descriptor_buffer_accesses_.emplace_back();
+        access.tag = tag;
+        access.address = buffer_binding.address;
+        access.descriptor_type = buffer_binding.descriptor_type;
+        access.sync_index = buffer_binding.sync_index;
+        access.set = buffer_binding.set;
+        access.binding = buffer_binding.binding;
+        access.render_area = cb_state_->active_render_pass_begin_info.renderArea;
+        access.pipeline = pipe->Handle();
+    }
 }
 
 bool CommandBufferAccessContext::ValidateDrawVertex(const std::optional<uint32_t> &vertexCount, uint32_t firstVertex,
@@ -786,14 +886,21 @@ void CommandBufferAccessContext::RecordClearAttachment(ResourceUsageTag tag, con
 QueueId CommandBufferAccessContext::GetQueueId() const { return kQueueIdInvalid; }
 
 ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(
-    vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
+    vvl::Func command, const syncval_state::RenderPass &rp_state, const VkRect2D &render_area,
     const std::vector<const syncval_state::ImageViewState *> &attachment_views) {
     // Create an access context the current renderpass.
-    const auto barrier_tag = NextCommandTag(command, NamedHandle("renderpass", rp_state.Handle()),
-                                            ResourceUsageRecord::SubcommandType::kSubpassTransition);
+    NamedHandle rp_handle(sync_state_->render_pass_handle_name_, rp_state.Handle());
+    const auto barrier_tag =
+        NextCommandTag(command, std::move(rp_handle), ResourceUsageRecord::SubcommandType::kSubpassTransition);
     const auto load_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kLoadOp);
-    render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+    if (render_pass_context_pool_.empty()) {
+        render_pass_contexts_.emplace_back(std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(),
+                                                                                     attachment_views, &cb_access_context_));
+    } else {
+        render_pass_contexts_.emplace_back(std::move(render_pass_context_pool_.back()));
+        render_pass_context_pool_.pop_back();
+        render_pass_contexts_.back()->Init(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_);
+    }
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -804,8 +911,8 @@ ResourceUsageTag CommandBufferAccessContext::RecordNextSubpass(vvl::Func command
     assert(current_renderpass_context_);
     if (!current_renderpass_context_) return NextCommandTag(command);
 
-    auto store_tag = NextCommandTag(command, NamedHandle("renderpass", current_renderpass_context_->GetRenderPassState()->Handle()),
-                                    ResourceUsageRecord::SubcommandType::kStoreOp);
+    NamedHandle rp_handle(sync_state_->render_pass_handle_name_, current_renderpass_context_->GetRenderPassState()->Handle());
+    auto store_tag = NextCommandTag(command, std::move(rp_handle), ResourceUsageRecord::SubcommandType::kStoreOp);
     auto barrier_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kSubpassTransition);
     auto load_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kLoadOp);
 
@@ -818,8 +925,8 @@ ResourceUsageTag CommandBufferAccessContext::RecordEndRenderPass(vvl::Func comma
     assert(current_renderpass_context_);
     if (!current_renderpass_context_) return NextCommandTag(command);
 
-    auto store_tag = NextCommandTag(command, NamedHandle("renderpass", current_renderpass_context_->GetRenderPassState()->Handle()),
-                                    ResourceUsageRecord::SubcommandType::kStoreOp);
+    NamedHandle rp_handle(sync_state_->render_pass_handle_name_, current_renderpass_context_->GetRenderPassState()->Handle());
+    auto store_tag = NextCommandTag(command, std::move(rp_handle), ResourceUsageRecord::SubcommandType::kStoreOp);
     auto barrier_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kSubpassTransition);
 
     current_renderpass_context_->RecordEndRenderPass(&cb_access_context_, store_tag, barrier_tag);
@@ -842,6 +949,11 @@ void CommandBufferAccessContext::RecordExecutedCommandBuffer(const CommandBuffer
         sync_op.sync_op->ReplayRecord(*this, base_tag + sync_op.tag);
     }
 
+    // The descriptor buffer accesses are validated when this command buffer is submitted
+    for (const SyncDescriptorBufferAccess &access : recorded_cb_context.GetDescriptorBufferAccesses()) {
+        descriptor_buffer_accesses_.emplace_back(access).tag += base_tag;
+    }
+
     ResourceUsageRange tag_range = ImportRecordedAccessLog(recorded_cb_context);
     assert(base_tag == tag_range.begin);  // to ensure the to offset calculation agree
     ResolveExecutedCommandBuffer(*recorded_context, tag_range.begin);
@@ -854,7 +966,7 @@ void CommandBufferAccessContext::ResolveExecutedCommandBuffer(const AccessContex
 
 void CommandBufferAccessContext::InsertRecordedAccessLogEntries(const CommandBufferAccessContext &recorded_context) {
     cbs_referenced_->emplace_back(recorded_context.GetCBStateShared());
-    access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
+    access_log_->append(recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
 
     // Adjust command indices for the log records added from recorded_context.
     const auto &recorded_label_commands = recorded_context.cb_state_->GetLabelCommands();
@@ -878,10 +990,6 @@ ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command
                                                                ResourceUsageRecord::SubcommandType subcommand) {
     ResourceUsageTag next = access_log_->size();
     access_log_->emplace_back(command, command_number_, subcommand, ++subcommand_number_, cb_state_, reset_count_);
-    if (command_handles_.size()) {
-        // This is a duplication, but it keeps tags->log information flat (i.e not depending on some "command tag" entry
-        access_log_->back().handles = command_handles_;
-    }
     if (handle) {
         access_log_->back().AddHandle(std::move(handle));
     }
@@ -898,13 +1006,12 @@ ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, R
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, NamedHandle &&handle,
                                                             ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
-    command_handles_.clear();
     subcommand_number_ = 0;
     ResourceUsageTag next = access_log_->size();
     access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_);
     if (handle) {
-        access_log_->back().AddHandle(handle);
-        command_handles_.emplace_back(std::move(handle));
+        access_log_->back().AddHandle(std::move(handle));
+        access_log_->back().has_command_handle = true;
     }
     if (!cb_state_->GetLabelCommands().empty()) {
         access_log_->back().label_command_index = static_cast<uint32_t>(cb_state_->GetLabelCommands().size() - 1);
@@ -1051,14 +1158,8 @@ static bool IsHazardVsRead(SyncHazard hazard) {
 
 static const SyncStageAccessInfoType *SyncStageAccessInfoFromMask(SyncStageAccessFlags flags) {
     // Return the info for the first bit found
-    const SyncStageAccessInfoType *info = nullptr;
-    for (size_t i = 0; i < flags.size(); i++) {
-        if (flags.test(i)) {
-            info = &syncStageAccessInfoByStageAccessIndex()[i];
-            break;
-        }
-    }
-    return info;
+    const size_t first = flags.find_first();
+    return (first < flags.size()) ? &syncStageAccessInfoByStageAccessIndex()[first] : nullptr;
 }
 
 static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags, const char *sep = "|") {
@@ -1068,7 +1169,7 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     } else {
         for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex().size(); i++) {
             const auto &info = syncStageAccessInfoByStageAccessIndex()[i];
-            if ((flags & info.stage_access_bit).any()) {
+            if (flags.intersects(info.stage_access_bit)) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
@@ -1100,8 +1201,9 @@ std::ostream &operator<<(std::ostream &out, const SyncNodeFormatter &formatter)
 std::ostream &operator<<(std::ostream &out, const NamedHandle::FormatterState &formatter) {
     const NamedHandle &handle = formatter.that;
     bool labeled = false;
-    if (!handle.name.empty()) {
-        out << handle.name;
+    const std::string_view name = formatter.state.GetHandleName(handle.name_id);
+    if (!name.empty()) {
+        out << name;
         labeled = true;
     }
     if (handle.IsIndexed()) {
@@ -1129,10 +1231,20 @@ std::ostream &operator<<(std::ostream &out, const ResourceUsageRecord::Formatter
         if (record.sub_command != 0) {
             out << ", subcmd: " << record.sub_command;
         }
+        const ResourceUsageRecordContext *context = formatter.context;
+        if (context && context->command_record && context->command_record->has_command_handle) {
+            out << ", " << context->command_record->handles[0].Formatter(formatter.sync_state);
+        }
         for (const auto &named_handle : record.handles) {
             out << ", " << named_handle.Formatter(formatter.sync_state);
         }
         out << ", reset_no: " << std::to_string(record.reset_count);
+        if (context && context->render_pass_command != vvl::kU32Max) {
+            if (context->subpass != vvl::kU32Max) {
+                out << ", subpass: " << context->subpass;
+            }
+            out << ", render_pass_cmd: " << context->render_pass_command;
+        }
 
         // Report debug region name. Empty name means that we are not inside any debug region.
         if (formatter.debug_name_provider) {
@@ -1163,6 +1275,10 @@ std::ostream &operator<<(std::ostream &out, const HazardResult::HazardState &haz
         SyncStageAccessFlags write_barrier = hazard.access_state->GetWriteBarriers();
         out << ", write_barriers: " << string_SyncStageAccessFlags(write_barrier);
     }
+    if (hazard.subresource) {
+        out << ", subresource: {aspect: " << string_VkImageAspectFlags(hazard.subresource->aspectMask)
+            << ", mip_level: " << hazard.subresource->mipLevel << ", array_layer: " << hazard.subresource->arrayLayer << "}";
+    }
     return out;
 }
 
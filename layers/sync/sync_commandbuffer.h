@@ -17,6 +17,7 @@
 #pragma once
 
 #include "sync/sync_renderpass.h"
+#include "sync/sync_descriptor_buffer.h"
 #include "state_tracker/cmd_buffer_state.h"
 
 class SyncValidator;
@@ -81,10 +82,11 @@ struct FormatterImpl {
 };
 
 struct NamedHandle {
-    const static size_t kInvalidIndex = std::numeric_limits<size_t>::max();
-    std::string name;
+    const static uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
     VulkanTypedHandle handle;
-    size_t index = kInvalidIndex;
+    // Id of the name in the SyncHandleNameTable of the device
+    SyncHandleNameTable::NameId name_id = SyncHandleNameTable::kNoName;
+    uint32_t index = kInvalidIndex;
 
     using FormatterState = FormatterImpl<SyncValidator, NamedHandle>;
     // NOTE: CRTP could DRY this
@@ -93,11 +95,9 @@ struct NamedHandle {
     NamedHandle() = default;
     NamedHandle(const NamedHandle &other) = default;
     NamedHandle(NamedHandle &&other) = default;
-    NamedHandle(const std::string &name_, const VulkanTypedHandle &handle_, size_t index_ = kInvalidIndex)
-        : name(name_), handle(handle_), index(index_) {}
-    NamedHandle(const char *name_, const VulkanTypedHandle &handle_, size_t index_ = kInvalidIndex)
-        : name(name_), handle(handle_), index(index_) {}
-    NamedHandle(const VulkanTypedHandle &handle_) : name(), handle(handle_) {}
+    NamedHandle(SyncHandleNameTable::NameId name_id_, const VulkanTypedHandle &handle_, uint32_t index_ = kInvalidIndex)
+        : handle(handle_), name_id(name_id_), index(index_) {}
+    NamedHandle(const VulkanTypedHandle &handle_) : handle(handle_) {}
     NamedHandle &operator=(const NamedHandle &other) = default;
     NamedHandle &operator=(NamedHandle &&other) = default;
 
@@ -143,23 +143,44 @@ struct ResourceCmdUsageRecord {
     NamedHandleVector handles;
 
     uint32_t label_command_index = vvl::kU32Max;
+    // handles[0] is the handle given with the command. Subcommand records do not copy it, it is looked up in the log when
+    // the record is reported (see ResourceUsageRecordContext)
+    bool has_command_handle = false;
 };
 
 struct DebugNameProvider;
+struct ResourceUsageRecord;
+
+// Context of a usage record that is not stored when recording, but reconstructed from the access log when a hazard
+// against the record is reported. Keeps the cost of detailed reports out of command recording.
+struct ResourceUsageRecordContext {
+    // First record of the command, for subcommand records
+    const ResourceUsageRecord *command_record = nullptr;
+    // Subpass index, only set for render pass instances begun with vkCmdBeginRenderPass
+    uint32_t subpass = vvl::kU32Max;
+    // Number of commands recorded since the beginning of the render pass instance
+    uint32_t render_pass_command = vvl::kU32Max;
+};
 
 struct ResourceUsageRecord : public ResourceCmdUsageRecord {
     struct FormatterState {
         FormatterState(const SyncValidator &sync_state_, const ResourceUsageRecord &record_, const vvl::CommandBuffer *cb_state_,
-                       const DebugNameProvider *debug_name_provider_)
-            : sync_state(sync_state_), record(record_), ex_cb_state(cb_state_), debug_name_provider(debug_name_provider_) {}
+                       const DebugNameProvider *debug_name_provider_, const ResourceUsageRecordContext *context_)
+            : sync_state(sync_state_),
+              record(record_),
+              ex_cb_state(cb_state_),
+              debug_name_provider(debug_name_provider_),
+              context(context_) {}
         const SyncValidator &sync_state;
         const ResourceUsageRecord &record;
         const vvl::CommandBuffer *ex_cb_state;
         const DebugNameProvider *debug_name_provider;
+        const ResourceUsageRecordContext *context;
     };
     FormatterState Formatter(const SyncValidator &sync_state, const vvl::CommandBuffer *ex_cb_state,
-                             const DebugNameProvider *debug_name_provider) const {
-        return FormatterState(sync_state, *this, ex_cb_state, debug_name_provider);
+                             const DebugNameProvider *debug_name_provider,
+                             const ResourceUsageRecordContext *context = nullptr) const {
+        return FormatterState(sync_state, *this, ex_cb_state, debug_name_provider, context);
     }
 
     AlternateResourceUsage alt_usage;
@@ -186,7 +207,8 @@ struct DebugNameProvider {
 // TODO: determine where to draw the design split for tag tracking (is there anything command to Queues and CB's)
 class CommandExecutionContext : public SyncValidationInfo {
   public:
-    using AccessLog = std::vector<ResourceUsageRecord>;
+    // Records are appended for every recorded command. Chunked storage never copies the records already logged when growing.
+    using AccessLog = chunked_vector<ResourceUsageRecord>;
     using CommandBufferSet = std::vector<std::shared_ptr<const vvl::CommandBuffer>>;
     CommandExecutionContext() : SyncValidationInfo(nullptr) {}
     CommandExecutionContext(const SyncValidator *sync_validator) : SyncValidationInfo(sync_validator) {}
@@ -217,6 +239,9 @@ class CommandExecutionContext : public SyncValidationInfo {
 
     ResourceUsageRange ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context);
 
+    // Walks the log back from the record at index, only meant to be used when reporting a hazard
+    static ResourceUsageRecordContext GetUsageRecordContext(const AccessLog &log, size_t index);
+
     virtual ResourceUsageTag GetTagLimit() const = 0;
     virtual VulkanTypedHandle Handle() const = 0;
     virtual void InsertRecordedAccessLogEntries(const CommandBufferAccessContext &cb_context) = 0;
@@ -278,6 +303,7 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     void Destroy() {
         // the cb self reference must be cleared or the command buffer reference count will never go to 0
         cbs_referenced_.reset();
+        descriptor_footprints_.clear();
         cb_state_ = nullptr;
     }
 
@@ -294,7 +320,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     RenderPassAccessContext *GetCurrentRenderPassContext() { return current_renderpass_context_; }
     const RenderPassAccessContext *GetCurrentRenderPassContext() const { return current_renderpass_context_; }
-    ResourceUsageTag RecordBeginRenderPass(vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
+    ResourceUsageTag RecordBeginRenderPass(vvl::Func command, const syncval_state::RenderPass &rp_state,
+                                           const VkRect2D &render_area,
                                            const std::vector<const syncval_state::ImageViewState *> &attachment_views);
 
     bool ValidateBeginRendering(const ErrorObject &error_obj, syncval_state::BeginRenderingCmdState &cmd_state) const;
@@ -375,7 +402,58 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     std::vector<vvl::CommandBuffer::LabelCommand> &GetProxyLabelCommands() { return proxy_label_commands_; }
 
+    const std::vector<SyncDescriptorBufferAccess> &GetDescriptorBufferAccesses() const { return descriptor_buffer_accesses_; }
+
   private:
+    // Descriptor accesses of a pipeline, gathered from the resource interface variables of its stages and the bound
+    // descriptor sets. Draws and dispatches replay it as long as the same sets are bound and have not been updated since.
+    // For sets bound from a descriptor buffer, as long as the set address is the same. Their descriptor data is only
+    // decoded at submit time, see SyncDescriptorBufferAccess.
+    struct DescriptorAccessFootprint {
+        struct Access {
+            const vvl::Descriptor *descriptor;
+            const vvl::DescriptorSet *descriptor_set;
+            // Either image_view or buffer is set, buffer_view is also set for texel buffers
+            const syncval_state::ImageViewState *image_view;
+            const vvl::BufferView *buffer_view;
+            const vvl::Buffer *buffer;
+            ResourceAccessRange range;
+            SyncStageAccessIndex sync_index;
+            VkDescriptorType descriptor_type;
+            uint32_t set;
+            uint32_t binding;
+            uint32_t index;
+
+            bool Invalid() const;
+            VkImageLayout GetImageLayout() const;
+        };
+        struct SetVersion {
+            bool used = false;
+            std::shared_ptr<const vvl::DescriptorSet> set;
+            uint64_t change_count = 0;
+            // Set bound from a descriptor buffer
+            std::shared_ptr<const vvl::DescriptorSetLayout> layout;
+            VkDeviceAddress descriptor_buffer_address = 0;
+        };
+        struct DescriptorBufferBinding {
+            VkDeviceAddress address;  // of the descriptor data
+            VkDescriptorType descriptor_type;
+            SyncStageAccessIndex sync_index;
+            uint32_t set;
+            uint32_t binding;
+        };
+
+        bool IsCurrent(const std::vector<LastBound::PER_SET> &per_sets, const vvl::CommandBuffer &cb_state) const;
+
+        // Hold references, so neither the pipeline nor the sets can be replaced by new objects at the same address
+        std::shared_ptr<const vvl::Pipeline> pipeline;
+        std::vector<SetVersion> sets;  // indexed by set number
+        std::vector<Access> accesses;
+        std::vector<DescriptorBufferBinding> descriptor_buffer_bindings;
+    };
+    const DescriptorAccessFootprint &GetDescriptorAccessFootprint(const vvl::Pipeline &pipe,
+                                                                  const std::vector<LastBound::PER_SET> &per_sets) const;
+
     // As this is passing around a shared pointer to record, move to avoid needless atomics.
     void RecordSyncOp(SyncOpPointer &&sync_op);
 
@@ -393,7 +471,6 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     uint32_t command_number_;
     uint32_t subcommand_number_;
     uint32_t reset_count_;
-    NamedHandleVector command_handles_;
 
     AccessContext cb_access_context_;
     AccessContext *current_context_;
@@ -401,6 +478,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     // Don't need the following for an active proxy cb context
     std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
+    // The render pass contexts of the previous recording, reused by the next render pass instances
+    std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_context_pool_;
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
 
@@ -412,6 +491,11 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     // Because in this case PreRecord is not called, the label state is not updated. We make
     // a copy of label state to update it locally together with proxy context.
     std::vector<vvl::CommandBuffer::LabelCommand> proxy_label_commands_;
+
+    // Built by the validation of a draw or dispatch, reused by its record and the next draws and dispatches
+    mutable vvl::unordered_map<const vvl::Pipeline *, DescriptorAccessFootprint> descriptor_footprints_;
+    // In tag order, including the ones of the executed secondary command buffers
+    std::vector<SyncDescriptorBufferAccess> descriptor_buffer_accesses_;
 };
 
 namespace syncval_state {
@@ -22,25 +22,37 @@
 
 extern const ResourceAccessRange kFullRange(std::numeric_limits<VkDeviceSize>::min(), std::numeric_limits<VkDeviceSize>::max());
 
-template <typename Flags, typename Map>
-SyncStageAccessFlags AccessScopeImpl(Flags flag_mask, const Map& map) {
-    SyncStageAccessFlags scope;
-    for (const auto& bit_scope : map) {
-        if (flag_mask < bit_scope.first) break;
+// Flattens a stage or access bit -> SyncStageAccessFlags map into a table indexed by bit position, so the scope of a mask is
+// the union of the table entries of its set bits instead of a walk over the whole map.
+using AccessScopeTable = std::array<SyncStageAccessFlags, 64>;
 
-        if (flag_mask & bit_scope.first) {
-            scope |= bit_scope.second;
+template <typename Map>
+static AccessScopeTable MakeAccessScopeTable(const Map& map) {
+    AccessScopeTable table{};
+    for (const auto& [flag_bits, scope] : map) {
+        for (uint64_t bits = flag_bits; bits != 0; bits &= bits - 1) {
+            table[SyncStageAccessFlags::LowestSetBit(bits)] |= scope;
         }
     }
+    return table;
+}
+
+static SyncStageAccessFlags AccessScopeImpl(uint64_t flag_mask, const AccessScopeTable& table) {
+    SyncStageAccessFlags scope;
+    for (; flag_mask != 0; flag_mask &= flag_mask - 1) {
+        scope |= table[SyncStageAccessFlags::LowestSetBit(flag_mask)];
+    }
     return scope;
 }
 
 SyncStageAccessFlags SyncStageAccess::AccessScopeByStage(VkPipelineStageFlags2KHR stages) {
-    return AccessScopeImpl(stages, syncStageAccessMaskByStageBit());
+    static const AccessScopeTable table = MakeAccessScopeTable(syncStageAccessMaskByStageBit());
+    return AccessScopeImpl(stages, table);
 }
 
 SyncStageAccessFlags SyncStageAccess::AccessScopeByAccess(VkAccessFlags2KHR accesses) {
-    return AccessScopeImpl(sync_utils::ExpandAccessFlags(accesses), syncStageAccessMaskByAccessBit());
+    static const AccessScopeTable table = MakeAccessScopeTable(syncStageAccessMaskByAccessBit());
+    return AccessScopeImpl(sync_utils::ExpandAccessFlags(accesses), table);
 }
 
 // Getting from stage mask and access mask to stage/access masks is something we need to be good at...
@@ -81,3 +93,34 @@ ResourceAccessRange MakeRange(const vvl::IndexBufferBinding& binding, uint32_t f
     }
     return MakeRange(binding);
 }
+
+SyncHandleNameTable::NameId SyncHandleNameTable::Intern(std::string_view name) {
+    if (name.empty()) {
+        return kNoName;
+    }
+    {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        auto it = ids_.find(name);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    const std::string& stored = names_.emplace_back(name);
+    const NameId id = static_cast<NameId>(names_.size());  // ids start at 1, 0 is kNoName
+    ids_.emplace(std::string_view(stored), id);
+    return id;
+}
+
+std::string_view SyncHandleNameTable::Name(NameId id) const {
+    if (id == kNoName) {
+        return {};
+    }
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    assert(id <= names_.size());
+    return names_[id - 1];
+}
@@ -15,6 +15,10 @@
  * limitations under the License.
  */
 #pragma once
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
 #include "error_message/error_location.h"
 #include "containers/subresource_adapter.h"
 #include "containers/range_vector.h"
@@ -31,6 +35,7 @@ namespace syncval_state {
 class CommandBuffer;
 class ImageState;
 class ImageViewState;
+class RenderPass;
 class Swapchain;
 }  // namespace syncval_state
 
@@ -87,6 +92,24 @@ class SyncValidationInfo {
 };
 
 
+// Per device table of the names given to the handles of the access log records ("renderpass", "pCommandBuffers", ...).
+// A record is created for every recorded command and the names are only needed when a hazard is reported, so the records
+// store the 32 bit id of the name instead of a string.
+class SyncHandleNameTable {
+  public:
+    using NameId = uint32_t;
+    static constexpr NameId kNoName = 0;
+
+    NameId Intern(std::string_view name);
+    std::string_view Name(NameId id) const;
+
+  private:
+    mutable std::shared_mutex lock_;
+    // The keys point into names_, std::deque never moves its elements on push_back
+    vvl::unordered_map<std::string_view, NameId> ids_;
+    std::deque<std::string> names_;
+};
+
 // Useful Utilites for manipulating StageAccess parameters, suitable as base class to save typing
 struct SyncStageAccess {
     static inline const SyncStageAccessInfoType &UsageInfo(SyncStageAccessIndex stage_access_index) {
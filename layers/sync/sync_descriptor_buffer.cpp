@@ -0,0 +1,138 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync/sync_descriptor_buffer.h"
+
+#include <algorithm>
+
+#include "sync/sync_validation.h"
+#include "sync/sync_image.h"
+#include "state_tracker/buffer_state.h"
+#include "state_tracker/device_memory_state.h"
+
+bool SyncDescriptorData::Invalid() const {
+    if (image_view) {
+        return image_view->Invalid();
+    }
+    // Descriptors without a tracked resource (null descriptors, samplers) have nothing to validate either
+    return !buffer || buffer->Invalid();
+}
+
+void SyncDescriptorDataCache::Record(const SyncValidator &sync_state, const VkDescriptorGetInfoEXT &info, size_t data_size,
+                                     const void *data) {
+    if (!data || data_size == 0) {
+        return;
+    }
+    auto decoded = std::make_shared<SyncDescriptorData>();
+    decoded->type = info.type;
+
+    const VkDescriptorImageInfo *image_info = nullptr;
+    const VkDescriptorAddressInfoEXT *address_info = nullptr;
+    switch (info.type) {
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            image_info = info.data.pCombinedImageSampler;
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            image_info = info.data.pSampledImage;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            image_info = info.data.pStorageImage;
+            break;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            image_info = info.data.pInputAttachmentImage;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            address_info = info.data.pUniformTexelBuffer;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            address_info = info.data.pStorageTexelBuffer;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            address_info = info.data.pUniformBuffer;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            address_info = info.data.pStorageBuffer;
+            break;
+        // TODO: ACCELERATION_STRUCTURE_KHR, same as for the descriptor sets
+        default:
+            break;
+    }
+
+    if (image_info && image_info->imageView != VK_NULL_HANDLE) {
+        auto view_state = sync_state.Get<syncval_state::ImageViewState>(image_info->imageView);
+        // Same restriction as for the descriptor sets, see GetDescriptorAccessFootprint
+        if (view_state && !view_state->IsDepthSliced()) {
+            decoded->image_view = std::move(view_state);
+            decoded->image_layout = image_info->imageLayout;
+        }
+    } else if (address_info && address_info->address != 0) {
+        const auto buffers = sync_state.GetBuffersByAddress(address_info->address);
+        if (!buffers.empty()) {
+            const VkDeviceSize offset = address_info->address - buffers[0]->deviceAddress;
+            decoded->buffer = sync_state.Get<vvl::Buffer>(buffers[0]->VkHandle());
+            if (decoded->buffer) {
+                decoded->range = MakeRange(*decoded->buffer, offset, address_info->range);
+            }
+        }
+    }
+
+    Key key{info.type, std::string(static_cast<const char *>(data), data_size)};
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    data_sizes_[info.type] = data_size;
+    // Undecoded data is stored too, so the same bytes can't keep resolving to a resource they no longer describe
+    descriptors_.insert_or_assign(std::move(key), std::move(decoded));
+    if (descriptors_.size() >= prune_threshold_) {
+        Prune();
+    }
+}
+
+void SyncDescriptorDataCache::Prune() {
+    vvl::EraseIf(descriptors_, [](const auto &entry) { return entry.second->Invalid(); });
+    prune_threshold_ = std::max(prune_threshold_, 2 * descriptors_.size());
+}
+
+size_t SyncDescriptorDataCache::GetDataSize(VkDescriptorType type) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    const size_t *data_size = vvl::Find(data_sizes_, type);
+    return data_size ? *data_size : 0;
+}
+
+std::shared_ptr<const SyncDescriptorData> SyncDescriptorDataCache::Find(VkDescriptorType type, const uint8_t *data,
+                                                                        size_t data_size) const {
+    const Key key{type, std::string(reinterpret_cast<const char *>(data), data_size)};
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    auto it = descriptors_.find(key);
+    return (it != descriptors_.end()) ? it->second : nullptr;
+}
+
+const uint8_t *SyncDescriptorDataCache::GetHostData(const ValidationStateTracker &device_state, VkDeviceAddress address,
+                                                    size_t size) {
+    for (const vvl::Buffer *buffer : device_state.GetBuffersByAddress(address)) {
+        const vvl::MEM_BINDING *binding = buffer->Binding();
+        if (!binding || !binding->memory_state) continue;
+        const vvl::DeviceMemory &memory = *binding->memory_state;
+        if (!memory.p_driver_data) continue;
+
+        const vvl::MemRange &mapped = memory.mapped_range;
+        const VkDeviceSize mapped_size =
+            (mapped.size == VK_WHOLE_SIZE) ? memory.allocate_info.allocationSize - mapped.offset : mapped.size;
+        const VkDeviceSize memory_offset = binding->memory_offset + (address - buffer->deviceAddress);
+        if (memory_offset < mapped.offset || memory_offset + size > mapped.offset + mapped_size) continue;
+        return static_cast<const uint8_t *>(memory.p_driver_data) + (memory_offset - mapped.offset);
+    }
+    return nullptr;
+}
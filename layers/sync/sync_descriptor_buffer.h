@@ -0,0 +1,97 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include "sync/sync_common.h"
+
+class SyncValidator;
+class ValidationStateTracker;
+
+namespace syncval_state {
+class ImageViewState;
+}  // namespace syncval_state
+
+// Resource referenced by the data of a descriptor written with vkGetDescriptorEXT
+struct SyncDescriptorData {
+    VkDescriptorType type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    // Either image_view or buffer is set
+    std::shared_ptr<const syncval_state::ImageViewState> image_view;
+    VkImageLayout image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    std::shared_ptr<const vvl::Buffer> buffer;
+    ResourceAccessRange range;
+
+    bool Invalid() const;
+};
+
+// Access of a draw or dispatch through a set bound from a descriptor buffer. The device reads the descriptor data when the
+// command executes and the application can write it until then, so it is only decoded and validated when the command buffer
+// is submitted, see ReplayState::ValidateDescriptorBufferAccess.
+struct SyncDescriptorBufferAccess {
+    ResourceUsageTag tag;
+    VkDeviceAddress address;  // of the descriptor data
+    VkDescriptorType descriptor_type;
+    SyncStageAccessIndex sync_index;
+    uint32_t set;
+    uint32_t binding;
+    VkRect2D render_area;  // for input attachments
+    VulkanTypedHandle pipeline;
+};
+
+// Decoded descriptors of VK_EXT_descriptor_buffer, keyed by the descriptor type and the bytes vkGetDescriptorEXT wrote.
+//
+// Applications get a descriptor once and copy its bytes to any number of places of their descriptor buffers, so the bytes
+// found at a descriptor buffer address are looked up instead of where they were first written.
+//
+// The bytes are read from the mapped descriptor buffer memory when the command buffers using them are submitted, once per
+// binding address and submitted command buffer. A host write racing with the submission can tear the read, the torn bytes
+// then very likely match no descriptor and the binding is not validated.
+class SyncDescriptorDataCache {
+  public:
+    void Record(const SyncValidator &sync_state, const VkDescriptorGetInfoEXT &info, size_t data_size, const void *data);
+
+    // Size of the data of the given descriptor type, 0 until a descriptor of this type is written
+    size_t GetDataSize(VkDescriptorType type) const;
+
+    // Decodes descriptor data of the given type, nullptr for unknown data
+    std::shared_ptr<const SyncDescriptorData> Find(VkDescriptorType type, const uint8_t *data, size_t data_size) const;
+
+    // Host pointer to the data at a descriptor buffer address. Only the data of host visible descriptor buffers that are mapped
+    // can be read, nullptr is returned for the other ones.
+    static const uint8_t *GetHostData(const ValidationStateTracker &device_state, VkDeviceAddress address, size_t size);
+
+  private:
+    struct Key {
+        VkDescriptorType type;
+        std::string data;
+        bool operator==(const Key &other) const { return type == other.type && data == other.data; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const { return std::hash<std::string>()(key.data) ^ static_cast<size_t>(key.type); }
+    };
+
+    // Drop the entries whose resources were destroyed
+    void Prune();
+
+    mutable std::shared_mutex lock_;
+    vvl::unordered_map<Key, std::shared_ptr<const SyncDescriptorData>, KeyHash> descriptors_;
+    // Size of the data written for each descriptor type, as given to vkGetDescriptorEXT
+    vvl::unordered_map<VkDescriptorType, size_t> data_sizes_;
+    size_t prune_threshold_ = 1024;
+};
@@ -39,6 +39,8 @@ class ImageState : public vvl::Image {
     VkDeviceSize GetOpaqueBaseAddress() const { return opaque_base_address_; }
     bool HasOpaqueMapping() const { return 0U != opaque_base_address_; }
     VkDeviceSize GetResourceBaseAddress() const;
+    // Inverse of the range generation, used to describe where a hazard was found
+    bool GetSubresourceAtAddress(VkDeviceSize address, VkImageSubresource &subresource) const;
     ImageRangeGen MakeImageRangeGen(const VkImageSubresourceRange &subresource_range, bool is_depth_sliced) const;
     ImageRangeGen MakeImageRangeGen(const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset,
                                     const VkExtent3D &extent, bool is_depth_sliced) const;
@@ -285,22 +285,13 @@ bool SyncOpPipelineBarrier::Validate(const CommandBufferAccessContext &cb_contex
 struct SyncOpPipelineBarrierFunctorFactory {
     using BarrierOpFunctor = PipelineBarrierOp;
     using ApplyFunctor = ApplyBarrierFunctor<BarrierOpFunctor>;
-    using GlobalBarrierOpFunctor = PipelineBarrierOp;
-    using GlobalApplyFunctor = ApplyBarrierOpsFunctor<GlobalBarrierOpFunctor>;
     using BufferRange = SingleRangeGenerator<ResourceAccessRange>;
     using ImageRange = subresource_adapter::ImageRangeGenerator;
-    using GlobalRange = SingleRangeGenerator<ResourceAccessRange>;
     using ImageState = syncval_state::ImageState;
 
     ApplyFunctor MakeApplyFunctor(QueueId queue_id, const SyncBarrier &barrier, bool layout_transition) const {
         return ApplyFunctor(BarrierOpFunctor(queue_id, barrier, layout_transition));
     }
-    GlobalApplyFunctor MakeGlobalApplyFunctor(size_t size_hint, ResourceUsageTag tag) const {
-        return GlobalApplyFunctor(true /* resolve */, size_hint, tag);
-    }
-    GlobalBarrierOpFunctor MakeGlobalBarrierOpFunctor(QueueId queue_id, const SyncBarrier &barrier) const {
-        return GlobalBarrierOpFunctor(queue_id, barrier, false);
-    }
 
     BufferRange MakeRangeGen(const vvl::Buffer &buffer, const ResourceAccessRange &range) const {
         if (!SimpleBinding(buffer)) return ResourceAccessRange();
@@ -310,7 +301,6 @@ struct SyncOpPipelineBarrierFunctorFactory {
     ImageRange MakeRangeGen(const ImageState &image, const VkImageSubresourceRange &subresource_range) const {
         return image.MakeImageRangeGen(subresource_range, false);
     }
-    GlobalRange MakeGlobalRangeGen() const { return kFullRange; }
 };
 
 template <typename Barriers, typename FunctorFactory>
@@ -363,7 +353,11 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     const auto queue_id = exec_context.GetQueueId();
     ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
     ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
-    ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    // Applied lazily, the batch also resolves the pending state left by the buffer and image barriers
+    if (!barrier_set.memory_barriers.empty() || !barrier_set.buffer_memory_barriers.empty() ||
+        !barrier_set.image_memory_barriers.empty()) {
+        access_context->RecordGlobalBarriers(queue_id, barrier_set.memory_barriers, exec_tag);
+    }
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope, exec_tag);
     } else {
@@ -1037,7 +1031,7 @@ SyncOpBeginRenderPass::SyncOpBeginRenderPass(vvl::Func command, const SyncValida
                                              const VkSubpassBeginInfo *pSubpassBeginInfo)
     : SyncOpBase(command), rp_context_(nullptr) {
     if (pRenderPassBegin) {
-        rp_state_ = sync_state.Get<vvl::RenderPass>(pRenderPassBegin->renderPass);
+        rp_state_ = sync_state.Get<syncval_state::RenderPass>(pRenderPassBegin->renderPass);
         renderpass_begin_info_ = vku::safe_VkRenderPassBeginInfo(pRenderPassBegin);
         auto fb_state = sync_state.Get<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
         if (fb_state) {
@@ -1068,8 +1062,8 @@ bool SyncOpBeginRenderPass::Validate(const CommandBufferAccessContext &cb_contex
     // Construct the state we can use to validate against... (since validation is const and RecordCmdBeginRenderPass
     // hasn't happened yet)
     const std::vector<AccessContext> empty_context_vector;
-    AccessContext temp_context(subpass, cb_context.GetQueueFlags(), rp_state.subpass_dependencies, empty_context_vector,
-                               cb_context.GetCurrentAccessContext());
+    const auto subpass_barriers = rp_state.GetSubpassBarriers(cb_context.GetQueueFlags());
+    AccessContext temp_context(subpass_barriers->subpasses[subpass], empty_context_vector, cb_context.GetCurrentAccessContext());
 
     // Validate attachment operations
     if (attachments_.empty()) return skip;
@@ -1230,7 +1224,8 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
         // We're allowing for the Replay(Validate|Record) to modify the exec_context (e.g. for Renderpass operations), so
         // we need to fetch the current access context each time
         hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
-                                                                  *exec_context_.GetCurrentAccessContext());
+                                                                  *exec_context_.GetCurrentAccessContext(),
+                                                                  exec_context_.GetSyncState().thread_pool.get());
 
         if (hazard.IsHazard()) {
             const SyncValidator &sync_state = exec_context_.GetSyncState();
@@ -1247,13 +1242,155 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
     return skip;
 }
 
+std::shared_ptr<const SyncDescriptorData> ReplayState::DecodeDescriptorBufferData(const SyncDescriptorBufferAccess &access) {
+    const auto found = decoded_descriptors_.find(access.address);
+    if (found != decoded_descriptors_.end() && found->second.type == access.descriptor_type) {
+        return found->second.data;
+    }
+
+    const SyncValidator &sync_state = exec_context_.GetSyncState();
+    const SyncDescriptorDataCache &data_cache = sync_state.descriptor_data_cache_;
+    std::shared_ptr<const SyncDescriptorData> descriptor_data;
+    // Nothing to decode if no descriptor of this type was written, or if the descriptor buffer memory is not mapped
+    const size_t data_size = data_cache.GetDataSize(access.descriptor_type);
+    const uint8_t *host_data = data_size ? SyncDescriptorDataCache::GetHostData(sync_state, access.address, data_size) : nullptr;
+    if (host_data) {
+        descriptor_data = data_cache.Find(access.descriptor_type, host_data, data_size);
+    }
+    decoded_descriptors_.insert_or_assign(access.address, DecodedDescriptor{access.descriptor_type, descriptor_data});
+    return descriptor_data;
+}
+
+// The recorded context and the accesses of this command buffer in the execution context use the tags of the recorded
+// access log, which is only imported in the execution context log after the replay
+std::string ReplayState::FormatDescriptorBufferHazard(const HazardResult &hazard, bool recorded) const {
+    if (recorded) {
+        return recorded_context_.FormatHazard(hazard);
+    }
+    if (hazard.Tag() < base_tag_) {
+        return exec_context_.FormatHazard(hazard);
+    }
+    std::stringstream out;
+    out << hazard.State();
+    out << ", " << recorded_context_.FormatUsage(hazard.Tag() - base_tag_) << ")";
+    return out.str();
+}
+
+// The descriptor buffer access is checked against the execution context, holding the accesses of the previous command buffers
+// and batches, the barriers replayed so far and the previous descriptor buffer accesses of this command buffer. Then against
+// the accesses recorded before it in this command buffer. The barriers recorded after it are already applied to these, and
+// the ones of a later write are lost, so this second check can miss hazards but reports no false ones.
+bool ReplayState::ValidateDescriptorBufferAccess(const SyncDescriptorBufferAccess &access) {
+    bool skip = false;
+    const std::shared_ptr<const SyncDescriptorData> descriptor_data = DecodeDescriptorBufferData(access);
+    // Unknown data or null descriptor, or the resource can have been destroyed, or a sparse resource can be partially bound
+    if (!descriptor_data || descriptor_data->Invalid()) {
+        return skip;
+    }
+
+    AccessContext &exec_access_context = *exec_context_.GetCurrentAccessContext();
+    const AccessContext &recorded_access_context = *GetRecordedAccessContext();
+    const ResourceUsageTag exec_tag = base_tag_ + access.tag;
+    const bool is_input_attachment = (access.sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ);
+    // Input attachments are subject to raster ordering rules
+    const SyncOrdering ordering_rule = is_input_attachment ? SyncOrdering::kRaster : SyncOrdering::kOrderingNone;
+    const VkOffset3D offset = CastTo3D(access.render_area.offset);
+    const VkExtent3D extent = CastTo3D(access.render_area.extent);
+
+    HazardResult hazard;
+    bool recorded = false;
+    const vvl::StateObject *resource = nullptr;
+    VulkanTypedHandle resource_handle;
+    if (const syncval_state::ImageViewState *image_view = descriptor_data->image_view.get()) {
+        resource = image_view->GetImageState();
+        resource_handle = image_view->Handle();
+        if (is_input_attachment) {
+            hazard = exec_access_context.DetectHazard(*image_view, offset, extent, access.sync_index, ordering_rule);
+        } else {
+            hazard = exec_access_context.DetectHazard(*image_view, access.sync_index);
+        }
+        if (!hazard.IsHazard()) {
+            const ImageRangeGen range_gen =
+                is_input_attachment ? image_view->MakeImageRangeGen(offset, extent) : image_view->GetFullViewImageRangeGen();
+            hazard = recorded_access_context.DetectHazardBeforeTag(*image_view, range_gen, access.sync_index, ordering_rule,
+                                                                   access.tag);
+            recorded = hazard.IsHazard();
+        }
+    } else {
+        const vvl::Buffer &buffer = *descriptor_data->buffer;
+        resource = &buffer;
+        resource_handle = buffer.Handle();
+        hazard = exec_access_context.DetectHazard(buffer, access.sync_index, descriptor_data->range);
+        if (!hazard.IsHazard()) {
+            hazard = recorded_access_context.DetectHazardBeforeTag(buffer, access.sync_index, descriptor_data->range, access.tag);
+            recorded = hazard.IsHazard();
+        }
+    }
+
+    if (recorded) {
+        // A previous descriptor buffer write replaced the recorded access, and has been checked against it
+        const ResourceUsageTag *write_tag = vvl::Find(descriptor_buffer_writes_, resource);
+        if (write_tag && hazard.Tag() < *write_tag) {
+            hazard = HazardResult();
+        }
+    }
+
+    const SyncValidator &sync_state = exec_context_.GetSyncState();
+    if (hazard.IsHazard() && !sync_state.SupressedBoundDescriptorWAW(hazard)) {
+        const LogObjectList objlist(exec_context_.Handle(), resource_handle);
+        const VkCommandBuffer recorded_handle = recorded_context_.GetCBState().VkHandle();
+        skip |= sync_state.LogError(
+            string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj_.location,
+            "Hazard %s for %s in entry %" PRIu32 ", %s, %s, and descriptor buffer set #%" PRIu32 ", type: %s, binding #%" PRIu32
+            ", accessed by %s. Access info %s.",
+            string_SyncHazard(hazard.Hazard()), sync_state.FormatHandle(resource_handle).c_str(), index_,
+            sync_state.FormatHandle(recorded_handle).c_str(), sync_state.FormatHandle(access.pipeline).c_str(), access.set,
+            string_VkDescriptorType(access.descriptor_type), access.binding, recorded_context_.FormatUsage(access.tag).c_str(),
+            FormatDescriptorBufferHazard(hazard, recorded).c_str());
+    }
+
+    // Recorded at its place in the command buffer, the later first uses and descriptor buffer accesses are checked against it
+    if (const syncval_state::ImageViewState *image_view = descriptor_data->image_view.get()) {
+        if (is_input_attachment) {
+            exec_access_context.UpdateAccessState(*image_view, access.sync_index, ordering_rule, offset, extent, exec_tag);
+        } else {
+            exec_access_context.UpdateAccessState(*image_view, access.sync_index, SyncOrdering::kNonAttachment, exec_tag);
+        }
+    } else {
+        exec_access_context.UpdateAccessState(*descriptor_data->buffer, access.sync_index, SyncOrdering::kNonAttachment,
+                                              descriptor_data->range, exec_tag);
+    }
+    if (SyncStageAccess::IsWrite(access.sync_index)) {
+        descriptor_buffer_writes_[resource] = access.tag;
+    }
+    return skip;
+}
+
 bool ReplayState::ValidateFirstUse() {
     if (!exec_context_.ValidForSyncOps()) return false;
 
     bool skip = false;
     ResourceUsageRange first_use_range = {0, 0};
 
+    // Descriptor buffer accesses are validated at submit time, each after the first uses of its command
+    const auto &descriptor_buffer_accesses = recorded_context_.GetDescriptorBufferAccesses();
+    auto descriptor_buffer_access = descriptor_buffer_accesses.cbegin();
+    const auto descriptor_buffer_access_end = (exec_context_.Type() == CommandExecutionContext::kSubmitted)
+                                                  ? descriptor_buffer_accesses.cend()
+                                                  : descriptor_buffer_access;
+    auto validate_descriptor_buffer_accesses = [&](ResourceUsageTag tag_limit) {
+        for (; descriptor_buffer_access != descriptor_buffer_access_end && descriptor_buffer_access->tag < tag_limit;
+             ++descriptor_buffer_access) {
+            first_use_range.end = descriptor_buffer_access->tag + 1;
+            skip |= DetectFirstUseHazard(first_use_range);
+            first_use_range.begin = first_use_range.end;
+            skip |= ValidateDescriptorBufferAccess(*descriptor_buffer_access);
+        }
+    };
+
     for (const auto &sync_op : recorded_context_.GetSyncOps()) {
+        validate_descriptor_buffer_accesses(sync_op.tag);
+
         // Set the range to cover all accesses until the next sync_op, and validate
         first_use_range.end = sync_op.tag;
         skip |= DetectFirstUseHazard(first_use_range);
@@ -1267,6 +1404,7 @@ bool ReplayState::ValidateFirstUse() {
     }
 
     // and anything after the last syncop
+    validate_descriptor_buffer_accesses(ResourceUsageRecord::kMaxIndex);
     first_use_range.end = ResourceUsageRecord::kMaxIndex;
     skip |= DetectFirstUseHazard(first_use_range);
 
@@ -1283,7 +1421,8 @@ AccessContext *ReplayState::RenderPassReplayState::Begin(VkQueueFlags queue_flag
     assert(rp_context);
     replay_context = &rp_context->GetContexts()[0];
 
-    InitSubpassContexts(queue_flags, *rp_context->GetRenderPassState(), &external_context, subpass_contexts);
+    // Shared with the recording command buffers of the render pass when they have the queue flags of the queue
+    InitSubpassContexts(*rp_context->GetRenderPassState()->GetSubpassBarriers(queue_flags), &external_context, subpass_contexts);
 
     // Replace the Async contexts with the the async context of the "external" context
     // For replay we don't care about async subpasses, just async queue batches
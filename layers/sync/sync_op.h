@@ -21,6 +21,8 @@
 
 class CommandBufferAccessContext;
 class CommandExecutionContext;
+struct SyncDescriptorBufferAccess;
+struct SyncDescriptorData;
 class RenderPassAccessContext;
 class ReplayState;
 
@@ -28,6 +30,7 @@ namespace vvl {
 class ImageView;
 class RenderPass;
 class CommandBuffer;
+class StateObject;
 }  // namespace vvl
 
 using SyncMemoryBarrier = SyncBarrier;
@@ -322,7 +325,7 @@ class SyncOpBeginRenderPass : public SyncOpBase {
     vku::safe_VkSubpassBeginInfo subpass_begin_info_;
     std::vector<std::shared_ptr<const vvl::ImageView>> shared_attachments_;
     std::vector<const syncval_state::ImageViewState *> attachments_;
-    std::shared_ptr<const vvl::RenderPass> rp_state_;
+    std::shared_ptr<const syncval_state::RenderPass> rp_state_;
     const RenderPassAccessContext *rp_context_;
 };
 
@@ -420,13 +423,17 @@ class ReplayState {
             begin_op = nullptr;
             replay_context = nullptr;
             subpass = VK_SUBPASS_EXTERNAL;
-            subpass_contexts.clear();
+            // Keep the contexts, the next render pass instance of the replay reuses them
+            for (auto &context : subpass_contexts) {
+                context.Reset();
+            }
         }
         operator bool() const { return begin_op != nullptr; }
     };
 
     bool ValidateFirstUse();
     bool DetectFirstUseHazard(const ResourceUsageRange &first_use_range) const;
+    bool ValidateDescriptorBufferAccess(const SyncDescriptorBufferAccess &access);
 
     ReplayState(CommandExecutionContext &exec_context, const CommandBufferAccessContext &recorded_context,
                 const ErrorObject &error_object, uint32_t index);
@@ -445,6 +452,8 @@ class ReplayState {
 
   protected:
     const AccessContext *GetRecordedAccessContext() const;
+    std::shared_ptr<const SyncDescriptorData> DecodeDescriptorBufferData(const SyncDescriptorBufferAccess &access);
+    std::string FormatDescriptorBufferHazard(const HazardResult &hazard, bool recorded) const;
 
     CommandExecutionContext &exec_context_;
     const CommandBufferAccessContext &recorded_context_;
@@ -452,4 +461,13 @@ class ReplayState {
     const uint32_t index_;
     const ResourceUsageTag base_tag_;
     RenderPassReplayState rp_replay_;
+
+    // The descriptor buffer data read by this replay, the command buffer can use the same binding address many times
+    struct DecodedDescriptor {
+        VkDescriptorType type;
+        std::shared_ptr<const SyncDescriptorData> data;
+    };
+    vvl::unordered_map<VkDeviceAddress, DecodedDescriptor> decoded_descriptors_;
+    // Tag of the last write made through a descriptor buffer, for each resource
+    vvl::unordered_map<const vvl::StateObject *, ResourceUsageTag> descriptor_buffer_writes_;
 };
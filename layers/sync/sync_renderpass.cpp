@@ -68,14 +68,36 @@ class UpdateStateResolveAction {
     const ResourceUsageTag tag_;
 };
 
-void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
+RenderPassSubpassBarriers::RenderPassSubpassBarriers(const vvl::RenderPass &rp_state, VkQueueFlags queue_flags_)
+    : queue_flags(queue_flags_) {
+    subpasses.reserve(rp_state.create_info.subpassCount);
+    for (uint32_t pass = 0; pass < rp_state.create_info.subpassCount; pass++) {
+        subpasses.emplace_back(queue_flags_, rp_state.subpass_dependencies[pass]);
+    }
+}
+
+std::shared_ptr<const RenderPassSubpassBarriers> syncval_state::RenderPass::GetSubpassBarriers(VkQueueFlags queue_flags) const {
+    std::lock_guard<std::mutex> guard(subpass_barriers_lock_);
+    for (const auto &subpass_barriers : subpass_barriers_) {
+        if (subpass_barriers->queue_flags == queue_flags) {
+            return subpass_barriers;
+        }
+    }
+    subpass_barriers_.emplace_back(std::make_shared<const RenderPassSubpassBarriers>(*this, queue_flags));
+    return subpass_barriers_.back();
+}
+
+void InitSubpassContexts(const RenderPassSubpassBarriers &subpass_barriers, const AccessContext *external_context,
                          std::vector<AccessContext> &subpass_contexts) {
-    const auto &create_info = rp_state.create_info;
-    // Add this for all subpasses here so that they exsist during next subpass validation
-    subpass_contexts.clear();
-    subpass_contexts.reserve(create_info.subpassCount);
-    for (uint32_t pass = 0; pass < create_info.subpassCount; pass++) {
-        subpass_contexts.emplace_back(pass, queue_flags, rp_state.subpass_dependencies, subpass_contexts, external_context);
+    const size_t subpass_count = subpass_barriers.subpasses.size();
+    // Add this for all subpasses here so that they exsist during next subpass validation. The contexts point to each other,
+    // so the vector must not reallocate once they are set up, and growing it would copy the contexts about to be replaced.
+    if (subpass_contexts.capacity() < subpass_count) {
+        subpass_contexts.clear();
+    }
+    subpass_contexts.resize(subpass_count);
+    for (size_t pass = 0; pass < subpass_count; pass++) {
+        subpass_contexts[pass].InitSubpass(subpass_barriers.subpasses[pass], subpass_contexts, external_context);
     }
 }
 
@@ -884,14 +906,38 @@ AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
     }
     return view_gens;
 }
-RenderPassAccessContext::RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
+RenderPassAccessContext::RenderPassAccessContext(const syncval_state::RenderPass &rp_state, const VkRect2D &render_area,
                                                  VkQueueFlags queue_flags,
                                                  const std::vector<const syncval_state::ImageViewState *> &attachment_views,
                                                  const AccessContext *external_context)
-    : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
+    : rp_state_(nullptr), render_area_(), current_subpass_(0U), attachment_views_() {
+    Init(rp_state, render_area, queue_flags, attachment_views, external_context);
+}
+
+void RenderPassAccessContext::Init(const syncval_state::RenderPass &rp_state, const VkRect2D &render_area,
+                                   VkQueueFlags queue_flags,
+                                   const std::vector<const syncval_state::ImageViewState *> &attachment_views,
+                                   const AccessContext *external_context) {
+    rp_state_ = &rp_state;
+    render_area_ = render_area;
+    current_subpass_ = 0U;
     // Add this for all subpasses here so that they exist during next subpass validation
-    InitSubpassContexts(queue_flags, rp_state, external_context, subpass_contexts_);
-    attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
+    InitSubpassContexts(*rp_state.GetSubpassBarriers(queue_flags), external_context, subpass_contexts_);
+    attachment_views_.clear();
+    const VkExtent3D extent = CastTo3D(render_area.extent);
+    const VkOffset3D offset = CastTo3D(render_area.offset);
+    for (const auto *view : attachment_views) {
+        attachment_views_.emplace_back(view, offset, extent);
+    }
+}
+
+void RenderPassAccessContext::Reset() {
+    for (auto &context : subpass_contexts_) {
+        context.Reset();
+    }
+    attachment_views_.clear();
+    rp_state_ = nullptr;
+    current_subpass_ = 0U;
 }
 void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barrier_tag, const ResourceUsageTag load_tag) {
     assert(0 == current_subpass_);
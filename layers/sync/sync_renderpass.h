@@ -19,9 +19,12 @@
 
 #include <vulkan/vulkan.h>
 
+#include <mutex>
+
 #include "sync/sync_common.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_op.h"
+#include "state_tracker/render_pass_state.h"
 
 class CommandExecutionContext;
 struct ClearAttachmentInfo;
@@ -72,7 +75,33 @@ struct BeginRenderingCmdState {
 };
 }  // namespace syncval_state
 
-void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
+// The SubpassBarriers of every subpass of a render pass, for the queue flags of the command buffers recording it.
+// Shared by the RenderPassAccessContexts of the render pass and by their replay at submit time.
+struct RenderPassSubpassBarriers {
+    RenderPassSubpassBarriers(const vvl::RenderPass &rp_state, VkQueueFlags queue_flags);
+
+    VkQueueFlags queue_flags;
+    std::vector<SubpassBarriers> subpasses;
+};
+
+namespace syncval_state {
+class RenderPass : public vvl::RenderPass {
+  public:
+    RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo) : vvl::RenderPass(handle, pCreateInfo) {}
+    RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreateInfo) : vvl::RenderPass(handle, pCreateInfo) {}
+
+    // Built on first use with queue_flags, then shared by every command buffer recording the render pass and by their replay
+    std::shared_ptr<const RenderPassSubpassBarriers> GetSubpassBarriers(VkQueueFlags queue_flags) const;
+
+  private:
+    mutable std::mutex subpass_barriers_lock_;
+    // One entry per distinct queue flags, a render pass is rarely used with more than one or two
+    mutable std::vector<std::shared_ptr<const RenderPassSubpassBarriers>> subpass_barriers_;
+};
+}  // namespace syncval_state
+
+// Contexts already in subpass_contexts are reused
+void InitSubpassContexts(const RenderPassSubpassBarriers &subpass_barriers, const AccessContext *external_context,
                          std::vector<AccessContext> &subpass_contexts);
 
 struct ClearAttachmentInfo {
@@ -104,9 +133,14 @@ class RenderPassAccessContext {
     static AttachmentViewGenVector CreateAttachmentViewGen(
         const VkRect2D &render_area, const std::vector<const syncval_state::ImageViewState *> &attachment_views);
     RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
-    RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+    RenderPassAccessContext(const syncval_state::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
                             const std::vector<const syncval_state::ImageViewState *> &attachment_views,
                             const AccessContext *external_context);
+    // Same as the constructor, for a context recycled from a previous render pass instance
+    void Init(const syncval_state::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
+              const std::vector<const syncval_state::ImageViewState *> &attachment_views, const AccessContext *external_context);
+    // Release the accesses and the render pass, keeping the storage for the next Init
+    void Reset();
 
     static bool ValidateLayoutTransitions(const SyncValidationInfo &val_info, const AccessContext &access_context,
                                           const vvl::RenderPass &rp_state, const VkRect2D &render_area, uint32_t subpass,
@@ -150,12 +184,12 @@ class RenderPassAccessContext {
     const AccessContext &CurrentContext() const { return subpass_contexts_[current_subpass_]; }
     const std::vector<AccessContext> &GetContexts() const { return subpass_contexts_; }
     uint32_t GetCurrentSubpass() const { return current_subpass_; }
-    const vvl::RenderPass *GetRenderPassState() const { return rp_state_; }
+    const syncval_state::RenderPass *GetRenderPassState() const { return rp_state_; }
     AccessContext *CreateStoreResolveProxy() const;
 
   private:
-    const vvl::RenderPass *rp_state_;
-    const VkRect2D render_area_;
+    const syncval_state::RenderPass *rp_state_;
+    VkRect2D render_area_;
     uint32_t current_subpass_;
     std::vector<AccessContext> subpass_contexts_;
     AttachmentViewGenVector attachment_views_;
@@ -0,0 +1,26 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+// Default values for those settings should match layers/VkLayer_khronos_validation.json.in
+
+#include <cstdint>
+
+struct SyncValSettings {
+    // Memory, in MB, the command buffer usage records referenced by the submitted batches may use before the records of
+    // retired batches are released. The access states themselves are not bounded. 0 means no budget.
+    uint32_t usage_log_budget_mb = 0;
+};
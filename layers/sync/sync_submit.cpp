@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "sync/sync_submit.h"
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
@@ -36,6 +38,13 @@ void SignaledSemaphoresUpdate::OnSignal(const std::shared_ptr<QueueBatchContext>
         return;
     }
     const VkSemaphore semaphore = sem_state->VkHandle();
+    if (sem_state->type == VK_SEMAPHORE_TYPE_TIMELINE) {
+        const VkQueueFlags queue_flags = batch->GetQueueFlags();
+        const SyncExecScope exec_scope = SyncExecScope::MakeSrc(queue_flags, signal_info.stageMask, VK_PIPELINE_STAGE_2_HOST_BIT);
+        // Each signaled value is tracked, non increasing values are an error (reported by core validation)
+        timeline_signals_to_add[semaphore].insert_or_assign(signal_info.value, SignalInfo(batch, exec_scope));
+        return;
+    }
     // Signal can't be registered in both lists at the same time.
     assert(!vvl::Contains(signals_to_add, semaphore) || !vvl::Contains(signals_to_remove, semaphore));
 
@@ -75,6 +84,32 @@ std::optional<SignalInfo> SignaledSemaphoresUpdate::OnUnsignal(VkSemaphore semap
     return unsignaled;
 }
 
+std::optional<SignalInfo> SignaledSemaphoresUpdate::OnTimelineWait(VkSemaphore semaphore, uint64_t value) const {
+    const SignalInfo* resolving_signal = nullptr;
+    uint64_t resolving_value = 0;
+    if (const TimelineSignals* global_signals = vvl::Find(sync_validator_.timeline_signals_, semaphore)) {
+        if (value <= global_signals->retired_value) {
+            return {};
+        }
+        if (auto it = global_signals->signals.lower_bound(value); it != global_signals->signals.end()) {
+            resolving_signal = &it->second;
+            resolving_value = it->first;
+        }
+    }
+    // Signals from the earlier batches of this submit replace the global ones with the same value
+    if (const auto* pending_signals = vvl::Find(timeline_signals_to_add, semaphore)) {
+        auto it = pending_signals->lower_bound(value);
+        if (it != pending_signals->end() && (!resolving_signal || it->first <= resolving_value)) {
+            resolving_signal = &it->second;
+        }
+    }
+    // No signal satisfies the wait yet (wait before signal), there is nothing to import
+    if (!resolving_signal) {
+        return {};
+    }
+    return *resolving_signal;
+}
+
 FenceSyncState::FenceSyncState() : fence(), tag(kInvalidTag), queue_id(kQueueIdInvalid) {}
 
 FenceSyncState::FenceSyncState(const std::shared_ptr<const vvl::Fence>& fence_, QueueId queue_id_, ResourceUsageTag tag_)
@@ -304,12 +339,19 @@ std::shared_ptr<QueueBatchContext> QueueBatchContext::ResolveOneWaitSemaphore(
 }
 
 std::shared_ptr<QueueBatchContext> QueueBatchContext::ResolveOneWaitSemaphore(
-    VkSemaphore sem, VkPipelineStageFlags2 wait_mask, SignaledSemaphoresUpdate& signaled_semaphores_update) {
-    auto sem_state = sync_state_->Get<vvl::Semaphore>(sem);
+    const VkSemaphoreSubmitInfo& wait_info, SignaledSemaphoresUpdate& signaled_semaphores_update) {
+    auto sem_state = sync_state_->Get<vvl::Semaphore>(wait_info.semaphore);
     if (!sem_state) return nullptr;  // Semaphore validity is handled by CoreChecks
+    const VkPipelineStageFlags2 wait_mask = wait_info.stageMask;
 
-    // When signal state goes out of scope, the signal information will be dropped, as Unsignal has released ownership.
-    auto signal_state = signaled_semaphores_update.OnUnsignal(sem);
+    // For binary semaphores, when signal state goes out of scope, the signal information will be dropped, as Unsignal has
+    // released ownership. Timeline waits leave the signal in place for the other waiters.
+    std::optional<SignalInfo> signal_state;
+    if (sem_state->type == VK_SEMAPHORE_TYPE_TIMELINE) {
+        signal_state = signaled_semaphores_update.OnTimelineWait(wait_info.semaphore, wait_info.value);
+    } else {
+        signal_state = signaled_semaphores_update.OnUnsignal(wait_info.semaphore);
+    }
     if (!signal_state) return nullptr;  // Invalid signal, skip it.
 
     assert(signal_state->batch);
@@ -431,8 +473,7 @@ void QueueBatchContext::SetupAccessContext(const std::shared_ptr<const QueueBatc
     const uint32_t wait_count = submit_info.waitSemaphoreInfoCount;
     const VkSemaphoreSubmitInfo* wait_infos = submit_info.pWaitSemaphoreInfos;
     for (const auto& wait_info : vvl::make_span(wait_infos, wait_count)) {
-        std::shared_ptr<QueueBatchContext> resolved =
-            ResolveOneWaitSemaphore(wait_info.semaphore, wait_info.stageMask, signaled_semaphores_update);
+        std::shared_ptr<QueueBatchContext> resolved = ResolveOneWaitSemaphore(wait_info, signaled_semaphores_update);
         if (resolved) {
             batches_resolved.emplace(std::move(resolved));
         }
@@ -508,9 +549,8 @@ void QueueBatchContext::SetupCommandBufferInfo(const VkSubmitInfo2& submit_info)
 std::string QueueBatchContext::FormatUsage(ResourceUsageTag tag) const {
     std::stringstream out;
     BatchAccessLog::AccessRecord access = batch_log_[tag];
-    if (access.IsValid()) {
+    if (access.batch) {
         const BatchAccessLog::BatchRecord& batch = *access.batch;
-        const ResourceUsageRecord& record = *access.record;
         if (batch.queue) {
             // Queue and Batch information (for enqueued operations)
             out << SyncNodeFormatter(*sync_state_, batch.queue->GetQueueState());
@@ -518,8 +558,12 @@ std::string QueueBatchContext::FormatUsage(ResourceUsageTag tag) const {
         }
         out << ", batch_tag: " << batch.bias;
 
-        // Commandbuffer Usages Information
-        out << ", " << record.Formatter(*sync_state_, nullptr, access.debug_name_provider);
+        if (access.record) {
+            // Commandbuffer Usages Information
+            out << ", " << access.record->Formatter(*sync_state_, nullptr, access.debug_name_provider, &access.context);
+        } else {
+            out << ", tag: " << tag << " (usage information released, see syncval_usage_log_budget)";
+        }
     }
     return out.str();
 }
@@ -589,6 +633,7 @@ bool QueueBatchContext::DoQueueSubmitValidate(const SyncValidator& sync_state, Q
 
         // The barriers have already been applied in ValidatFirstUse
         ResourceUsageRange tag_range = ImportRecordedAccessLog(cb_access_context);
+        cmd_state.submitted_usage_records += tag_range.size();
         ResolveSubmittedCommandBuffer(*cb_access_context.GetCurrentAccessContext(), tag_range.begin);
         vvl::CommandBuffer::ReplayLabelCommands(cb.cb->GetLabelCommands(), *current_label_stack_);
     }
@@ -685,6 +730,9 @@ QueueBatchContext::BatchSet SyncValidator::GetQueueBatchSnapshot() {
     };
 
     GetQueueBatchSnapshotImpl<QueueBatchContext::BatchSet>(signaled_semaphores_, append);
+    for (const auto& timeline_entry : timeline_signals_) {
+        GetQueueBatchSnapshotImpl<QueueBatchContext::BatchSet>(timeline_entry.second.signals, append);
+    }
     return snapshot;
 }
 
@@ -696,10 +744,15 @@ uint64_t QueueSyncState::ReserveSubmitId() const { return submit_index_.fetch_ad
 
 void QueueSyncState::SetPendingLastBatch(std::shared_ptr<QueueBatchContext>&& last) const { pending_last_batch_ = std::move(last); }
 
-VkSemaphoreSubmitInfo SubmitInfoConverter::BatchStore::WaitSemaphore(const VkSubmitInfo& info, uint32_t index) {
+VkSemaphoreSubmitInfo SubmitInfoConverter::BatchStore::WaitSemaphore(const VkSubmitInfo& info,
+                                                                     const VkTimelineSemaphoreSubmitInfo* timeline_info,
+                                                                     uint32_t index) {
     VkSemaphoreSubmitInfo semaphore_info = vku::InitStructHelper();
     semaphore_info.semaphore = info.pWaitSemaphores[index];
     semaphore_info.stageMask = info.pWaitDstStageMask[index];
+    if (timeline_info && timeline_info->pWaitSemaphoreValues && index < timeline_info->waitSemaphoreValueCount) {
+        semaphore_info.value = timeline_info->pWaitSemaphoreValues[index];
+    }
     return semaphore_info;
 }
 VkCommandBufferSubmitInfo SubmitInfoConverter::BatchStore::CommandBuffer(const VkSubmitInfo& info, uint32_t index) {
@@ -708,21 +761,26 @@ VkCommandBufferSubmitInfo SubmitInfoConverter::BatchStore::CommandBuffer(const V
     return cb_info;
 }
 
-VkSemaphoreSubmitInfo SubmitInfoConverter::BatchStore::SignalSemaphore(const VkSubmitInfo& info, uint32_t index,
-                                                                       VkQueueFlags queue_flags) {
+VkSemaphoreSubmitInfo SubmitInfoConverter::BatchStore::SignalSemaphore(const VkSubmitInfo& info,
+                                                                       const VkTimelineSemaphoreSubmitInfo* timeline_info,
+                                                                       uint32_t index, VkQueueFlags queue_flags) {
     VkSemaphoreSubmitInfo semaphore_info = vku::InitStructHelper();
     semaphore_info.semaphore = info.pSignalSemaphores[index];
     semaphore_info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    if (timeline_info && timeline_info->pSignalSemaphoreValues && index < timeline_info->signalSemaphoreValueCount) {
+        semaphore_info.value = timeline_info->pSignalSemaphoreValues[index];
+    }
     return semaphore_info;
 }
 
 SubmitInfoConverter::BatchStore::BatchStore(const VkSubmitInfo& info, VkQueueFlags queue_flags) {
     info2 = vku::InitStructHelper();
+    const auto* timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(info.pNext);
 
     info2.waitSemaphoreInfoCount = info.waitSemaphoreCount;
     waits.reserve(info2.waitSemaphoreInfoCount);
     for (uint32_t i = 0; i < info2.waitSemaphoreInfoCount; ++i) {
-        waits.emplace_back(WaitSemaphore(info, i));
+        waits.emplace_back(WaitSemaphore(info, timeline_info, i));
     }
     info2.pWaitSemaphoreInfos = waits.data();
 
@@ -736,7 +794,7 @@ SubmitInfoConverter::BatchStore::BatchStore(const VkSubmitInfo& info, VkQueueFla
     info2.signalSemaphoreInfoCount = info.signalSemaphoreCount;
     signals.reserve(info2.signalSemaphoreInfoCount);
     for (uint32_t i = 0; i < info2.signalSemaphoreInfoCount; ++i) {
-        signals.emplace_back(SignalSemaphore(info, i, queue_flags));
+        signals.emplace_back(SignalSemaphore(info, timeline_info, i, queue_flags));
     }
     info2.pSignalSemaphoreInfos = signals.data();
 }
@@ -825,6 +883,37 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
     }
 }
 
+size_t BatchAccessLog::CountRecords(vvl::unordered_set<const CommandExecutionContext::AccessLog*>& counted_logs) const {
+    size_t records = 0;
+    for (const auto& entry : log_map_) {
+        const auto* log = entry.second.GetLog();
+        if (log && counted_logs.insert(log).second) {
+            records += log->size();
+        }
+    }
+    return records;
+}
+
+size_t BatchAccessLog::Retire(const std::vector<ResourceUsageRange>& live_ranges, size_t& retired_records) {
+    size_t retired_logs = 0;
+    for (auto& entry : log_map_) {
+        const ResourceUsageRange& range = entry.first;
+        if (!entry.second.GetLog()) continue;  // Already retired
+
+        // First live range ending after the log begins, the only one which can overlap it
+        const auto live = std::lower_bound(live_ranges.begin(), live_ranges.end(), range.begin,
+                                           [](const ResourceUsageRange& live_range, ResourceUsageTag tag) {
+                                               return live_range.end <= tag;
+                                           });
+        if (live != live_ranges.end() && live->begin < range.end) continue;
+
+        retired_records += entry.second.Size();
+        entry.second.Retire();
+        ++retired_logs;
+    }
+    return retired_logs;
+}
+
 BatchAccessLog::AccessRecord BatchAccessLog::operator[](ResourceUsageTag tag) const {
     auto found_log = log_map_.find(tag);
     if (found_log != log_map_.cend()) {
@@ -843,12 +932,22 @@ std::string BatchAccessLog::CBSubmitLog::GetDebugRegionName(const ResourceUsageR
 
 BatchAccessLog::AccessRecord BatchAccessLog::CBSubmitLog::operator[](ResourceUsageTag tag) const {
     assert(tag >= batch_.bias);
+    if (!log_) {
+        // Retired, only the batch is known
+        return AccessRecord{&batch_, nullptr, nullptr, {}};
+    }
     const size_t index = tag - batch_.bias;
-    assert(log_);
     assert(index < log_->size());
     const ResourceUsageRecord* record = &(*log_)[index];
     const auto debug_name_provider = (record->label_command_index == vvl::kU32Max) ? nullptr : this;
-    return AccessRecord{&batch_, record, debug_name_provider};
+    return AccessRecord{&batch_, record, debug_name_provider, CommandExecutionContext::GetUsageRecordContext(*log_, index)};
+}
+
+void BatchAccessLog::CBSubmitLog::Retire() {
+    cbs_.reset();
+    log_.reset();
+    initial_label_stack_ = std::vector<std::string>();
+    label_commands_ = std::vector<vvl::CommandBuffer::LabelCommand>();
 }
 
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch,
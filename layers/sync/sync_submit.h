@@ -16,6 +16,8 @@
  */
 
 #pragma once
+#include <map>
+
 #include "sync/sync_commandbuffer.h"
 #include "state_tracker/queue_state.h"
 
@@ -65,14 +67,26 @@ struct SignalInfo {
 // Globally tracks signaled semaphores.
 using SignaledSemaphores = vvl::unordered_map<VkSemaphore, SignalInfo>;
 
+// Signals of a timeline semaphore, ordered by the signaled value. A wait resolves to the signal with the smallest value not less
+// than the waited one, and does not consume it, any number of waits can resolve to the same signal.
+struct TimelineSignals {
+    std::map<uint64_t, SignalInfo> signals;
+    // Signals are pruned from the front once the host waited for their batch. Waits for values up to the largest pruned
+    // value are satisfied by completed work and import nothing.
+    uint64_t retired_value = 0;
+};
+using TimelineSemaphores = vvl::unordered_map<VkSemaphore, TimelineSignals>;
+
 // The list of changes that should to be applied to SignaledSemaphores.
 // These changes are collected during validation phase of QueueSubmit and are applied in the record phase.
 struct SignaledSemaphoresUpdate {
     vvl::unordered_map<VkSemaphore, SignalInfo> signals_to_add;
     vvl::unordered_set<VkSemaphore> signals_to_remove;
+    vvl::unordered_map<VkSemaphore, std::map<uint64_t, SignalInfo>> timeline_signals_to_add;
 
     void OnSignal(const std::shared_ptr<QueueBatchContext> &batch, const VkSemaphoreSubmitInfo &signal_info);
     std::optional<SignalInfo> OnUnsignal(VkSemaphore semaphore);
+    std::optional<SignalInfo> OnTimelineWait(VkSemaphore semaphore, uint64_t value) const;
 
     SignaledSemaphoresUpdate(const SyncValidator &sync_validator) : sync_validator_(sync_validator) {}
 
@@ -140,6 +154,7 @@ class BatchAccessLog {
         const BatchRecord *batch;
         const ResourceUsageRecord *record;
         const DebugNameProvider *debug_name_provider;
+        ResourceUsageRecordContext context;
         bool IsValid() const { return batch && record; }
     };
 
@@ -154,8 +169,11 @@ class BatchAccessLog {
                     std::shared_ptr<const CommandExecutionContext::AccessLog> log);
         CBSubmitLog(const BatchRecord &batch, const CommandBufferAccessContext &cb,
                     const std::vector<std::string> &initial_label_stack);
-        size_t Size() const { return log_->size(); }
+        size_t Size() const { return log_ ? log_->size() : 0; }
         AccessRecord operator[](ResourceUsageTag tag) const;
+        const CommandExecutionContext::AccessLog *GetLog() const { return log_.get(); }
+        // Release the usage records, only the batch information is kept
+        void Retire();
 
         // DebugNameProvider
         std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
@@ -185,6 +203,11 @@ class BatchAccessLog {
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    // Number of usage records of the logs not in counted_logs yet, which are then added to it
+    size_t CountRecords(vvl::unordered_set<const CommandExecutionContext::AccessLog *> &counted_logs) const;
+    // Retire the logs not overlapping any of live_ranges (sorted and disjoint). Returns the number of logs retired and adds
+    // their record count to retired_records.
+    size_t Retire(const std::vector<ResourceUsageRange> &live_ranges, size_t &retired_records);
     // AccessRecord lookup is based on global tags
     AccessRecord operator[](ResourceUsageTag tag) const;
     BatchAccessLog() {}
@@ -254,6 +277,12 @@ class QueueBatchContext : public CommandExecutionContext {
     void SetupBatchTags();
     void SetCurrentLabelStack(std::vector<std::string>* current_label_stack);
     void ResetEventsContext() { events_context_.Clear(); }
+    size_t CountLogRecords(vvl::unordered_set<const CommandExecutionContext::AccessLog *> &counted_logs) const {
+        return batch_log_.CountRecords(counted_logs);
+    }
+    size_t RetireAccessLog(const std::vector<ResourceUsageRange> &live_ranges, size_t &retired_records) {
+        return batch_log_.Retire(live_ranges, retired_records);
+    }
     ResourceUsageTag GetTagLimit() const override { return batch_.bias; }
     // begin is the tag bias  / .size() is the number of total records that should eventually be in access_log_
     ResourceUsageRange GetTagRange() const { return tag_range_; }
@@ -298,7 +327,7 @@ class QueueBatchContext : public CommandExecutionContext {
                                   QueueBatchContext::ConstBatchSet &batches_resolved);
     std::shared_ptr<QueueBatchContext> ResolveOneWaitSemaphore(VkSemaphore sem, const PresentedImages &presented_images,
                                                                SignaledSemaphoresUpdate &signaled_semaphores_update);
-    std::shared_ptr<QueueBatchContext> ResolveOneWaitSemaphore(VkSemaphore sem, VkPipelineStageFlags2 wait_mask,
+    std::shared_ptr<QueueBatchContext> ResolveOneWaitSemaphore(const VkSemaphoreSubmitInfo &wait_info,
                                                                SignaledSemaphoresUpdate &signaled_semaphores_update);
 
     void ImportSyncTags(const QueueBatchContext &from);
@@ -364,9 +393,11 @@ struct SubmitInfoConverter {
     struct BatchStore {
         BatchStore(const VkSubmitInfo &info, VkQueueFlags queue_flags);
 
-        static VkSemaphoreSubmitInfo WaitSemaphore(const VkSubmitInfo &info, uint32_t index);
+        static VkSemaphoreSubmitInfo WaitSemaphore(const VkSubmitInfo &info, const VkTimelineSemaphoreSubmitInfo *timeline_info,
+                                                   uint32_t index);
         static VkCommandBufferSubmitInfo CommandBuffer(const VkSubmitInfo &info, uint32_t index);
-        static VkSemaphoreSubmitInfo SignalSemaphore(const VkSubmitInfo &info, uint32_t index, VkQueueFlags queue_flags);
+        static VkSemaphoreSubmitInfo SignalSemaphore(const VkSubmitInfo &info, const VkTimelineSemaphoreSubmitInfo *timeline_info,
+                                                     uint32_t index, VkQueueFlags queue_flags);
 
         std::vector<VkSemaphoreSubmitInfo> waits;
         std::vector<VkCommandBufferSubmitInfo> cbs;
@@ -384,6 +415,8 @@ struct QueueSubmitCmdState {
     std::shared_ptr<const QueueSyncState> queue;
     const ErrorObject &error_obj;
     SignaledSemaphoresUpdate signaled_semaphores_update;
+    // Usage records of the submitted command buffers, for the syncval_usage_log_budget accounting
+    size_t submitted_usage_records = 0;
     QueueSubmitCmdState(const ErrorObject &error_obj, const SyncValidator &sync_validator)
         : error_obj(error_obj), signaled_semaphores_update(sync_validator) {}
 };
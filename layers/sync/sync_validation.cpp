@@ -16,6 +16,7 @@
  */
 
 #include <algorithm>
+#include <cinttypes>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -54,6 +55,63 @@ void SyncValidator::UpdateSignaledSemaphores(SignaledSemaphoresUpdate &update,
     for (VkSemaphore semaphore : update.signals_to_remove) {
         signaled_semaphores_.erase(semaphore);
     }
+    for (auto &timeline_entry : update.timeline_signals_to_add) {
+        TimelineSignals &timeline = timeline_signals_[timeline_entry.first];
+        for (auto &signal_entry : timeline_entry.second) {
+            auto &signal_batch = signal_entry.second.batch;
+            if (signal_batch != last_batch) {
+                signal_batch->ResetEventsContext();
+                signal_batch->Trim();
+            }
+            timeline.signals.insert_or_assign(signal_entry.first, std::move(signal_entry.second));
+        }
+    }
+}
+
+void SyncValidator::RetireTimelineSignals(QueueId queue_id, ResourceUsageTag tag) {
+    const bool any_queue = (queue_id == kQueueAny);
+    for (auto &timeline_entry : timeline_signals_) {
+        // The entry stays when all signals are gone, retired_value still answers the waits for the pruned values
+        TimelineSignals &timeline = timeline_entry.second;
+        // Signaled values increase in execution order, once a signal is waited all the smaller values have been reached too.
+        // Only the front is pruned so that a wait never resolves to a larger value than the one that satisfies it.
+        auto signal_it = timeline.signals.begin();
+        while (signal_it != timeline.signals.end()) {
+            const std::shared_ptr<QueueBatchContext> &batch = signal_it->second.batch;
+            // Empty batches have no tags to compare with, only an idle wait retires them
+            const ResourceUsageRange batch_tags = batch->GetTagRange();
+            const bool waited = (any_queue || batch->GetQueueId() == queue_id) &&
+                                (tag == ResourceUsageRecord::kMaxIndex || (batch_tags.non_empty() && batch_tags.end <= tag));
+            if (!waited) break;
+            timeline.retired_value = signal_it->first;
+            signal_it = timeline.signals.erase(signal_it);
+        }
+    }
+}
+
+void SyncValidator::RetireTimelineSignalsUpTo(VkSemaphore semaphore, uint64_t value) {
+    auto timeline_it = timeline_signals_.find(semaphore);
+    if (timeline_it == timeline_signals_.end()) return;
+
+    // The batches of the completed signals are waited by the host, as for a fence
+    vvl::unordered_map<QueueId, ResourceUsageTag> waited_tags;
+    for (const auto &signal_entry : timeline_it->second.signals) {
+        if (signal_entry.first > value) break;
+        const std::shared_ptr<QueueBatchContext> &batch = signal_entry.second.batch;
+        const ResourceUsageRange batch_tags = batch->GetTagRange();
+        if (batch_tags.non_empty()) {
+            ResourceUsageTag &waited_tag = waited_tags[batch->GetQueueId()];
+            waited_tag = std::max(waited_tag, batch_tags.end);
+        }
+    }
+    for (const auto &waited : waited_tags) {
+        ApplyTaggedWait(waited.first, waited.second);
+    }
+
+    // Signals of empty batches have no tags to wait for, and are removed by value
+    TimelineSignals &timeline = timeline_it->second;
+    timeline.signals.erase(timeline.signals.begin(), timeline.signals.upper_bound(value));
+    timeline.retired_value = std::max(timeline.retired_value, value);
 }
 
 void SyncValidator::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
@@ -73,6 +131,7 @@ void SyncValidator::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
         }
     };
     ForAllQueueBatchContexts(tagged_wait_op);
+    RetireTimelineSignals(queue_id, tag);
 }
 
 void SyncValidator::ApplyAcquireWait(const AcquiredImage &acquired) {
@@ -83,6 +142,55 @@ void SyncValidator::ApplyAcquireWait(const AcquiredImage &acquired) {
     ForAllQueueBatchContexts(acq_wait_op);
 }
 
+// The logs are shared by all the batches which imported them, count each once
+static size_t CountUsageLogRecords(const QueueBatchContext::BatchSet &batches) {
+    vvl::unordered_set<const CommandExecutionContext::AccessLog *> counted_logs;
+    size_t records = 0;
+    for (const auto &batch : batches) {
+        records += batch->CountLogRecords(counted_logs);
+    }
+    return records;
+}
+
+void SyncValidator::EnforceUsageLogBudget(size_t submitted_records) {
+    if (syncval_settings.usage_log_budget_mb == 0) return;
+    const size_t budget_records = (size_t(syncval_settings.usage_log_budget_mb) << 20) / sizeof(ResourceUsageRecord);
+
+    // Counting the records the batches reference walks all of them, so it is only done once the records submitted since the
+    // last count could exceed the budget. Resubmitted command buffers share their log, this estimate is an upper bound.
+    usage_log_budget_.estimated_records += submitted_records;
+    if (usage_log_budget_.estimated_records <= std::max(budget_records, usage_log_budget_.next_sweep_records)) return;
+
+    QueueBatchContext::BatchSet batches = GetQueueBatchSnapshot();
+    usage_log_budget_.estimated_records = CountUsageLogRecords(batches);
+    if (usage_log_budget_.estimated_records <= budget_records) return;
+
+    // Only the usage information of the batches which are neither the last batch of a queue nor the batch of a pending signal
+    // is released, it is only needed to report the prior access of a hazard. The access states are kept so hazards against
+    // them are still detected.
+    std::vector<ResourceUsageRange> live_ranges;
+    live_ranges.reserve(batches.size());
+    for (const auto &batch : batches) {
+        if (batch->GetTagRange().non_empty()) {
+            live_ranges.emplace_back(batch->GetTagRange());
+        }
+    }
+    std::sort(live_ranges.begin(), live_ranges.end(),
+              [](const ResourceUsageRange &a, const ResourceUsageRange &b) { return a.begin < b.begin; });
+
+    size_t retired_records = 0;
+    for (const auto &batch : batches) {
+        usage_log_budget_.retired_logs += batch->RetireAccessLog(live_ranges, retired_records);
+    }
+    usage_log_budget_.retired_records += retired_records;
+    usage_log_budget_.sweeps++;
+
+    // When the logs of the live batches alone use most of the budget, sweeping again at the next submit cannot release much.
+    // Wait for half a budget of new records instead, which keeps the cost of the sweeps linear in the number of records.
+    usage_log_budget_.estimated_records = CountUsageLogRecords(batches);
+    usage_log_budget_.next_sweep_records = usage_log_budget_.estimated_records + budget_records / 2;
+}
+
 template <typename BatchOp>
 void SyncValidator::ForAllQueueBatchContexts(BatchOp &&op) {
     // Often we need to go through every queue batch context and apply synchronization operations
@@ -178,6 +286,16 @@ std::shared_ptr<vvl::ImageView> SyncValidator::CreateImageViewState(
     return std::make_shared<ImageViewState>(image_state, iv, ci, ff, cubic_props);
 }
 
+std::shared_ptr<vvl::RenderPass> SyncValidator::CreateRenderPassState(VkRenderPass handle,
+                                                                      const VkRenderPassCreateInfo *pCreateInfo) {
+    return std::static_pointer_cast<vvl::RenderPass>(std::make_shared<syncval_state::RenderPass>(handle, pCreateInfo));
+}
+
+std::shared_ptr<vvl::RenderPass> SyncValidator::CreateRenderPassState(VkRenderPass handle,
+                                                                      const VkRenderPassCreateInfo2 *pCreateInfo) {
+    return std::static_pointer_cast<vvl::RenderPass>(std::make_shared<syncval_state::RenderPass>(handle, pCreateInfo));
+}
+
 bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                  uint32_t regionCount, const VkBufferCopy *pRegions,
                                                  const ErrorObject &error_obj) const {
@@ -586,6 +704,18 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
     vvl::ToLower(debug_cmdbuf_pattern);
 }
 
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                               const RecordObject &record_obj) {
+    if (usage_log_budget_.sweeps != 0) {
+        LogInfo("SYNCVAL_USAGE_LOG_BUDGET", device, record_obj.location,
+                "syncval_usage_log_budget (%" PRIu32 " MB) was exceeded %" PRIu64 " times, %" PRIu64
+                " command buffer logs (%" PRIu64 " usage records) were retired.",
+                syncval_settings.usage_log_budget_mb, usage_log_budget_.sweeps, usage_log_budget_.retired_logs,
+                usage_log_budget_.retired_records);
+    }
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+}
+
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                             const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const {
     bool skip = false;
@@ -2732,7 +2862,7 @@ void SyncValidator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
         const ResourceUsageTag cb_tag = cb_context->NextIndexedCommandTag(record_obj.location.function, cb_index);
         const auto recorded_cb = Get<syncval_state::CommandBuffer>(pCommandBuffers[cb_index]);
         if (!recorded_cb) continue;
-        cb_context->AddHandle(cb_tag, "pCommandBuffers", recorded_cb->Handle(), cb_index);
+        cb_context->AddHandle(cb_tag, command_buffers_handle_name_, recorded_cb->Handle(), cb_index);
         const auto *recorded_cb_context = &recorded_cb->access_context;
         cb_context->RecordExecutedCommandBuffer(*recorded_cb_context);
     }
@@ -2777,6 +2907,7 @@ void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordOb
     // We need to treat this a fence waits for all queues... noting that present engine ops will be preserved.
     ForAllQueueBatchContexts(
         [](const std::shared_ptr<QueueBatchContext> &batch) { batch->ApplyTaggedWait(kQueueAny, ResourceUsageRecord::kMaxIndex); });
+    RetireTimelineSignals(kQueueAny, ResourceUsageRecord::kMaxIndex);
 
     // As we we've waited for everything on device, any waits are mooted. (except for acquires)
     vvl::EraseIf(waitable_fences_, [](SignaledFences::value_type &waitable) { return waitable.second.acquired.Invalid(); });
@@ -2868,6 +2999,7 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
         presented.ExportToSwapchain(*this);
     }
     queue_state->UpdateLastBatch();
+    EnforceUsageLogBudget(cmd_state->presented_images.size());
 }
 
 void SyncValidator::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
@@ -3016,6 +3148,7 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, const Record
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
     UpdateSignaledSemaphores(cmd_state->signaled_semaphores_update, queue_state->PendingLastBatch());
     queue_state->UpdateLastBatch();
+    EnforceUsageLogBudget(cmd_state->submitted_usage_records);
 
     ResourceUsageRange fence_tag_range = ReserveGlobalTagRange(1U);
     UpdateFenceWaitInfo(fence, queue_state->GetQueueId(), fence_tag_range.begin);
@@ -3062,6 +3195,45 @@ void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceC
     }
 }
 
+void SyncValidator::PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                                 const RecordObject &record_obj) {
+    StateTracker::PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, record_obj);
+    if (disabled[sync_validation_queue_submit]) return;
+    const bool wait_any = (pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT) != 0;
+    // As for fences, the values are only known to be reached if all of them were waited, or there was only one of them
+    if ((record_obj.result == VK_SUCCESS) && (!wait_any || pWaitInfo->semaphoreCount == 1)) {
+        for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; i++) {
+            RetireTimelineSignalsUpTo(pWaitInfo->pSemaphores[i], pWaitInfo->pValues[i]);
+        }
+    }
+}
+
+void SyncValidator::PostCallRecordSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo,
+                                                  const RecordObject &record_obj) {
+    StateTracker::PostCallRecordSignalSemaphore(device, pSignalInfo, record_obj);
+    if (disabled[sync_validation_queue_submit]) return;
+    if (record_obj.result == VK_SUCCESS) {
+        // A host signal must be smaller than the pending signals, so the signals up to its value have already completed
+        RetireTimelineSignalsUpTo(pSignalInfo->semaphore, pSignalInfo->value);
+    }
+}
+
+void SyncValidator::PostCallRecordGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
+                                                           const RecordObject &record_obj) {
+    StateTracker::PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, record_obj);
+    if (disabled[sync_validation_queue_submit]) return;
+    if (record_obj.result == VK_SUCCESS) {
+        RetireTimelineSignalsUpTo(semaphore, *pValue);
+    }
+}
+
+void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator,
+                                                  const RecordObject &record_obj) {
+    // A new semaphore can get the same handle, it must not inherit the signals and the retired value of this one
+    timeline_signals_.erase(semaphore);
+    StateTracker::PreCallRecordDestroySemaphore(device, semaphore, pAllocator, record_obj);
+}
+
 void SyncValidator::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
                                                         VkImage *pSwapchainImages, const RecordObject &record_obj) {
     StateTracker::PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, record_obj);
@@ -3080,6 +3252,13 @@ void SyncValidator::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapc
     }
 }
 
+void SyncValidator::PostCallRecordGetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT *pDescriptorInfo,
+                                                   size_t dataSize, void *pDescriptor, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor, record_obj);
+    if (!pDescriptorInfo) return;
+    descriptor_data_cache_.Record(*this, *pDescriptorInfo, dataSize, pDescriptor);
+}
+
 bool syncval_state::ImageState::IsSimplyBound() const {
     bool simple = SimpleBinding(static_cast<const vvl::Bindable &>(*this)) || IsSwapchainImage() || bind_swapchain;
 
@@ -3121,6 +3300,13 @@ VkDeviceSize syncval_state::ImageState::GetResourceBaseAddress() const {
     return GetFakeBaseAddress();
 }
 
+bool syncval_state::ImageState::GetSubresourceAtAddress(VkDeviceSize address, VkImageSubresource &subresource) const {
+    if (!fragment_encoder || !IsSimplyBound()) return false;
+    const VkDeviceSize base_address = GetResourceBaseAddress();
+    if (address < base_address) return false;
+    return fragment_encoder->DecodeSubresource(address - base_address, subresource);
+}
+
 ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresourceRange &subresource_range,
                                                            bool is_depth_sliced) const {
     if (!fragment_encoder || !IsSimplyBound()) {
@@ -27,11 +27,13 @@
 #include "sync/sync_renderpass.h"
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_submit.h"
+#include "sync/sync_descriptor_buffer.h"
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, syncval_state::CommandBuffer, vvl::CommandBuffer)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkSwapchainKHR, syncval_state::Swapchain, vvl::Swapchain)
+VALSTATETRACK_DERIVED_STATE_OBJECT(VkRenderPass, syncval_state::RenderPass, vvl::RenderPass)
 
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
@@ -42,7 +44,11 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using Struct = vvl::Struct;
     using Field = vvl::Field;
 
-    SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
+    SyncValidator()
+        : render_pass_handle_name_(handle_names_.Intern("renderpass")),
+          command_buffers_handle_name_(handle_names_.Intern("pCommandBuffers")) {
+        container_type = LayerObjectTypeSyncValidation;
+    }
 
     // Global tag range for submitted command buffers resource usage logs
     // Started the global tag count at 1 s.t. zero are invalid and ResourceUsageTag normalization can just zero them.
@@ -53,6 +59,10 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     QueueId queue_id_limit_ = kQueueIdBase;
 
     SignaledSemaphores signaled_semaphores_;
+    TimelineSemaphores timeline_signals_;
+
+    // Fed by vkGetDescriptorEXT, read when the submitted command buffers decode their descriptor buffer bindings
+    SyncDescriptorDataCache descriptor_data_cache_;
 
     using SignaledFences = vvl::unordered_map<VkFence, FenceSyncState>;
     SignaledFences waitable_fences_;
@@ -61,12 +71,37 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     uint32_t debug_reset_count = 1;
     std::string debug_cmdbuf_pattern;
 
-    // Applies information from update object to signaled_semaphores_.
+    // Interning happens at record time, thus mutable like tag_limit_
+    mutable SyncHandleNameTable handle_names_;
+    // Names used on every record of their command, interned once
+    const SyncHandleNameTable::NameId render_pass_handle_name_;
+    const SyncHandleNameTable::NameId command_buffers_handle_name_;
+
+    // syncval_usage_log_budget bookkeeping, what was released is reported at device destruction
+    struct UsageLogBudget {
+        // Records referenced by the batches at the last count, plus the records submitted since
+        size_t estimated_records = 0;
+        // No sweep until estimated_records exceeds this, when the live batches alone were over budget at the last sweep
+        size_t next_sweep_records = 0;
+        uint64_t sweeps = 0;
+        uint64_t retired_logs = 0;
+        uint64_t retired_records = 0;
+    };
+    UsageLogBudget usage_log_budget_;
+
+    // Applies information from update object to signaled_semaphores_ and timeline_signals_.
     // The update object is mutable to be able to std::move SignalInfo from it.
     void UpdateSignaledSemaphores(SignaledSemaphoresUpdate &update, const std::shared_ptr<QueueBatchContext> &last_batch);
 
     void ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag);
+    // Drop the timeline signals whose batch has been waited by the host, in value order
+    void RetireTimelineSignals(QueueId queue_id, ResourceUsageTag tag);
+    // The host observed that the counter of a timeline semaphore reached value: the signals up to value have completed
+    void RetireTimelineSignalsUpTo(VkSemaphore semaphore, uint64_t value);
     void ApplyAcquireWait(const AcquiredImage &acquired);
+    // Retire the access logs no queue or signal batch needs, when the batches reference more usage records than
+    // syncval_usage_log_budget allows. submitted_records is the number of records the calling submit added.
+    void EnforceUsageLogBudget(size_t submitted_records);
     template <typename BatchOp>
     void ForAllQueueBatchContexts(BatchOp &&op);
 
@@ -82,6 +117,9 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     std::shared_ptr<QueueSyncState> GetQueueSyncStateShared(VkQueue queue);
     QueueId GetQueueIdLimit() const { return queue_id_limit_; }
 
+    SyncHandleNameTable::NameId InternHandleName(std::string_view name) const { return handle_names_.Intern(name); }
+    std::string_view GetHandleName(SyncHandleNameTable::NameId id) const { return handle_names_.Name(id); }
+
     QueueBatchContext::BatchSet GetQueueBatchSnapshot();
 
     template <typename Predicate>
@@ -106,6 +144,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     std::shared_ptr<vvl::ImageView> CreateImageViewState(const std::shared_ptr<vvl::Image> &image_state, VkImageView iv,
                                                          const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
                                                          const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) final;
+    std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle, const VkRenderPassCreateInfo *pCreateInfo) final;
+    std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle, const VkRenderPassCreateInfo2 *pCreateInfo) final;
 
     void RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                   const VkSubpassBeginInfo *pSubpassBeginInfo, Func command);
@@ -115,6 +155,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                    const RecordObject &record_obj) override;
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const;
@@ -570,9 +612,19 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
                                     const RecordObject &record_obj) override;
     void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, const RecordObject &record_obj) override;
+    void PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                      const RecordObject &record_obj) override;
+    void PostCallRecordSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo,
+                                       const RecordObject &record_obj) override;
+    void PostCallRecordGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
+                                                const RecordObject &record_obj) override;
+    void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator,
+                                       const RecordObject &record_obj) override;
     void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
                                      uint64_t timeout, const RecordObject &record_obj) override;
     void PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount,
                                              VkImage *pSwapchainImages, const RecordObject &record_obj) override;
+    void PostCallRecordGetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT *pDescriptorInfo, size_t dataSize,
+                                        void *pDescriptor, const RecordObject &record_obj) override;
 };
 
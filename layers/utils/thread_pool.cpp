@@ -0,0 +1,208 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace vvl {
+
+// Lets Submit() push to the deque of the worker it is called from
+static thread_local const ThreadPool *tls_pool = nullptr;
+static thread_local uint32_t tls_worker_index = 0;
+
+ThreadPool::ThreadPool(uint32_t thread_count, bool collect_stats) : thread_count_(thread_count), collect_stats_(collect_stats) {
+    queues_.reserve(thread_count_);
+    for (uint32_t i = 0; i < thread_count_; ++i) {
+        queues_.emplace_back(std::make_unique<WorkerQueue>());
+    }
+}
+
+ThreadPool::~ThreadPool() { Shutdown(); }
+
+void ThreadPool::StartWorkers() {
+    workers_.reserve(thread_count_);
+    for (uint32_t i = 0; i < thread_count_; ++i) {
+        workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+void ThreadPool::Submit(const char *name, std::function<void()> &&func, TaskGroup *group) {
+    Task task{name, std::move(func), group};
+    if (group) {
+        group->pending_.fetch_add(1, std::memory_order_acq_rel);
+    }
+    if (thread_count_ == 0 || shutdown_.load(std::memory_order_acquire)) {
+        RunTask(task);
+        return;
+    }
+    std::call_once(start_once_, [this]() { StartWorkers(); });
+
+    const uint32_t queue_index =
+        (tls_pool == this) ? tls_worker_index : next_queue_.fetch_add(1, std::memory_order_relaxed) % thread_count_;
+    bool enqueued = false;
+    {
+        // Workers only exit once they see shutdown_ with no queued task while holding sleep_lock_, so checking shutdown_ and
+        // enqueuing under that lock guarantees a queued task is always run. It also makes sure a worker about to sleep sees
+        // the new task.
+        std::lock_guard<std::mutex> sleep_guard(sleep_lock_);
+        if (!shutdown_.load(std::memory_order_acquire)) {
+            // Counted before the push, a worker popping the task right away must never decrement the count below 0
+            queued_tasks_.fetch_add(1, std::memory_order_acq_rel);
+            WorkerQueue &queue = *queues_[queue_index];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            queue.tasks.emplace_back(std::move(task));
+            enqueued = true;
+        }
+    }
+    if (!enqueued) {
+        // The workers are gone or about to exit
+        RunTask(task);
+        return;
+    }
+    workers_wake_.notify_one();
+}
+
+bool ThreadPool::PopTask(uint32_t worker_index, Task &task) {
+    WorkerQueue &queue = *queues_[worker_index];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    queued_tasks_.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+// thief_index can be thread_count_ for threads that are not workers, in which case every queue is a victim
+bool ThreadPool::StealTask(uint32_t thief_index, Task &task) {
+    for (uint32_t i = 1; i <= thread_count_; ++i) {
+        const uint32_t victim = (thief_index + i) % thread_count_;
+        if (victim == thief_index) {
+            continue;
+        }
+        WorkerQueue &queue = *queues_[victim];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            queued_tasks_.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::TakeGroupTask(const TaskGroup &group, Task &task) {
+    for (auto &queue_ptr : queues_) {
+        WorkerQueue &queue = *queue_ptr;
+        std::lock_guard<std::mutex> guard(queue.lock);
+        auto it = std::find_if(queue.tasks.begin(), queue.tasks.end(), [&group](const Task &t) { return t.group == &group; });
+        if (it != queue.tasks.end()) {
+            task = std::move(*it);
+            queue.tasks.erase(it);
+            queued_tasks_.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::RunTask(Task &task) {
+    if (collect_stats_) {
+        const auto start = std::chrono::steady_clock::now();
+        task.func();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        std::lock_guard<std::mutex> guard(stats_lock_);
+        TaskStats &stats = stats_[task.name];
+        ++stats.count;
+        stats.total_ns += static_cast<uint64_t>(elapsed.count());
+    } else {
+        task.func();
+    }
+
+    if (task.group && task.group->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        {
+            std::lock_guard<std::mutex> guard(sleep_lock_);
+        }
+        waiters_wake_.notify_all();
+    }
+}
+
+void ThreadPool::WorkerLoop(uint32_t worker_index) {
+    tls_pool = this;
+    tls_worker_index = worker_index;
+    while (true) {
+        Task task;
+        if (PopTask(worker_index, task) || StealTask(worker_index, task)) {
+            RunTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(sleep_lock_);
+        workers_wake_.wait(guard, [this]() {
+            return shutdown_.load(std::memory_order_acquire) || queued_tasks_.load(std::memory_order_acquire) > 0;
+        });
+        // Queued tasks are always drained before the workers exit
+        if (shutdown_.load(std::memory_order_acquire) && queued_tasks_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::Wait(TaskGroup &group) {
+    // Only tasks of group are run here, an unrelated task could take much longer than the ones the caller waits on
+    Task task;
+    while (!group.Done() && TakeGroupTask(group, task)) {
+        RunTask(task);
+    }
+    // The remaining tasks of group are running on the workers, the last one to finish wakes this thread
+    std::unique_lock<std::mutex> guard(sleep_lock_);
+    waiters_wake_.wait(guard, [&group]() { return group.Done(); });
+}
+
+void ThreadPool::Shutdown() {
+    // Waits for a concurrent StartWorkers() to be done, and makes sure no worker is started after the join below
+    std::call_once(start_once_, []() {});
+    {
+        std::lock_guard<std::mutex> guard(sleep_lock_);
+        shutdown_.store(true, std::memory_order_release);
+    }
+    workers_wake_.notify_all();
+    for (auto &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+std::vector<std::pair<const char *, ThreadPool::TaskStats>> ThreadPool::GetTaskStats() const {
+    std::lock_guard<std::mutex> guard(stats_lock_);
+    return {stats_.begin(), stats_.end()};
+}
+
+std::string ThreadPool::DescribeTaskStats() const {
+    std::ostringstream ss;
+    for (const auto &[name, stats] : GetTaskStats()) {
+        ss << "\n    " << name << ": " << stats.count << " tasks, " << (stats.total_ns / 1000000) << " ms";
+    }
+    return ss.str();
+}
+
+}  // namespace vvl
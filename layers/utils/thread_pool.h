@@ -0,0 +1,111 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Device scoped pool of worker threads shared by all the validation objects.
+//
+// Each worker owns a deque of tasks: it pops its own tasks from the back and, once empty, steals from the front of the other
+// workers' deques. Tasks submitted from a worker go to that worker's deque, tasks submitted from application threads are
+// spread round robin. Threads are only started on the first submission, so a device that never uses the pool pays nothing.
+//
+// A thread count of 0 runs every task inline on the submitting thread. Task times are only measured when collect_stats is set.
+class ThreadPool {
+  public:
+    // Tracks completion of a set of tasks
+    class TaskGroup {
+      public:
+        bool Done() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+      private:
+        friend class ThreadPool;
+        std::atomic<uint32_t> pending_{0};
+    };
+
+    struct TaskStats {
+        uint64_t count = 0;
+        uint64_t total_ns = 0;
+    };
+
+    ThreadPool(uint32_t thread_count, bool collect_stats = false);
+    ~ThreadPool();
+
+    uint32_t ThreadCount() const { return thread_count_; }
+
+    // name must be a string literal, it is used to attribute time in the task stats
+    void Submit(const char *name, std::function<void()> &&func, TaskGroup *group = nullptr);
+    // The calling thread runs the queued tasks of group while waiting, so it is safe to wait from a worker. Tasks of other groups
+    // (ex. shader instrumentation while syncval waits on a submit) are left to the workers.
+    void Wait(TaskGroup &group);
+
+    // Runs all the tasks still queued then joins the workers. Must be called before the objects referenced by the tasks are
+    // destroyed (ex. at the very beginning of vkDestroyDevice).
+    void Shutdown();
+
+    std::vector<std::pair<const char *, TaskStats>> GetTaskStats() const;
+    std::string DescribeTaskStats() const;
+
+  private:
+    struct Task {
+        const char *name;
+        std::function<void()> func;
+        TaskGroup *group;
+    };
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    void StartWorkers();
+    void WorkerLoop(uint32_t worker_index);
+    bool PopTask(uint32_t worker_index, Task &task);
+    bool StealTask(uint32_t thief_index, Task &task);
+    bool TakeGroupTask(const TaskGroup &group, Task &task);
+    void RunTask(Task &task);
+
+    const uint32_t thread_count_;
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::once_flag start_once_;
+    std::atomic<uint32_t> next_queue_{0};
+    std::atomic<uint32_t> queued_tasks_{0};
+    std::atomic<bool> shutdown_{false};
+
+    // Workers and Wait() callers sleep on different condition variables, the notify_one of Submit() must reach a worker
+    std::mutex sleep_lock_;
+    std::condition_variable workers_wake_;
+    std::condition_variable waiters_wake_;
+
+    const bool collect_stats_;
+    mutable std::mutex stats_lock_;
+    vvl::unordered_map<const char *, TaskStats> stats_;
+};
+
+}  // namespace vvl
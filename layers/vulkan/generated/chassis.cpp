@@ -416,8 +416,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
     CHECK_ENABLED local_enables{};
     CHECK_DISABLED local_disables{};
     bool lock_setting;
+    uint32_t thread_pool_size = 0;
+    bool thread_pool_stats = false;
     GpuAVSettings local_gpuav_settings = {};
     DebugPrintfSettings local_printf_settings = {};
+    SyncValSettings local_syncval_settings = {};
     ConfigAndEnvSettings config_and_env_settings_data{OBJECT_LAYER_DESCRIPTION,
                                                       pCreateInfo,
                                                       local_enables,
@@ -426,8 +429,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
                                                       &debug_report->duplicate_message_limit,
                                                       &debug_report->message_format_settings,
                                                       &lock_setting,
+                                                      &thread_pool_size,
+                                                      &thread_pool_stats,
                                                       &local_gpuav_settings,
-                                                      &local_printf_settings};
+                                                      &local_printf_settings,
+                                                      &local_syncval_settings};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     LayerDebugMessengerActions(debug_report, OBJECT_LAYER_DESCRIPTION);
 
@@ -486,8 +492,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
     framework->disabled = local_disables;
     framework->enabled = local_enables;
     framework->fine_grained_locking = lock_setting;
+    framework->thread_pool_size = thread_pool_size;
+    framework->thread_pool_stats = thread_pool_stats;
     framework->gpuav_settings = local_gpuav_settings;
     framework->printf_settings = local_printf_settings;
+    framework->syncval_settings = local_syncval_settings;
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -506,8 +515,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
         intercept->enabled = framework->enabled;
         intercept->disabled = framework->disabled;
         intercept->fine_grained_locking = framework->fine_grained_locking;
+        intercept->thread_pool_size = framework->thread_pool_size;
+        intercept->thread_pool_stats = framework->thread_pool_stats;
         intercept->gpuav_settings = framework->gpuav_settings;
         intercept->printf_settings = framework->printf_settings;
+        intercept->syncval_settings = framework->syncval_settings;
         intercept->instance = *pInstance;
     }
 
@@ -634,6 +646,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     InitDeviceObjectDispatch(instance_interceptor, device_interceptor);
 
+    device_interceptor->thread_pool_stats = instance_interceptor->thread_pool_stats;
+    device_interceptor->thread_pool =
+        std::make_shared<vvl::ThreadPool>(instance_interceptor->thread_pool_size, instance_interceptor->thread_pool_stats);
+    device_interceptor->queue_retirement_scheduler = std::make_shared<vvl::QueueRetirementScheduler>();
+
     // Initialize all of the objects with the appropriate data
     for (auto* object : device_interceptor->object_dispatch) {
         object->device = device_interceptor->device;
@@ -647,6 +664,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         object->fine_grained_locking = instance_interceptor->fine_grained_locking;
         object->gpuav_settings = instance_interceptor->gpuav_settings;
         object->printf_settings = instance_interceptor->printf_settings;
+        object->syncval_settings = instance_interceptor->syncval_settings;
+        object->thread_pool = device_interceptor->thread_pool;
+        object->queue_retirement_scheduler = device_interceptor->queue_retirement_scheduler;
         object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
         object->instance_extensions = instance_interceptor->instance_extensions;
         object->device_extensions = device_interceptor->device_extensions;
@@ -677,6 +697,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
     }
 
+    // Tasks still queued can reference any state object, they must be done before the validation objects start tearing down
+    if (layer_data->thread_pool) {
+        layer_data->thread_pool->Shutdown();
+        if (layer_data->thread_pool_stats) {
+            const std::string task_stats = layer_data->thread_pool->DescribeTaskStats();
+            if (!task_stats.empty()) {
+                layer_data->LogInfo("THREAD_POOL_STATS", device, error_obj.location, "Validation thread pool time:%s",
+                                    task_stats.c_str());
+            }
+        }
+    }
+
     RecordObject record_obj(vvl::Func::vkDestroyDevice);
     for (ValidationObject* intercept : layer_data->object_dispatch) {
         auto lock = intercept->WriteLock();
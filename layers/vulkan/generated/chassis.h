@@ -54,6 +54,8 @@
 #include "vk_dispatch_table_helper.h"
 #include "vk_extension_helper.h"
 #include "gpu_validation/gpu_settings.h"
+#include "sync/sync_settings.h"
+#include "utils/thread_pool.h"
 
 extern std::atomic<uint64_t> global_unique_id;
 
@@ -84,6 +86,7 @@ struct CreateBuffer;
 namespace vvl {
 struct AllocateDescriptorSetsData;
 class Pipeline;
+class QueueRetirementScheduler;
 }  // namespace vvl
 
 // Because of GPL, we currently create our Pipeline state objects before the PreCallValidate
@@ -2227,6 +2230,14 @@ class ValidationObject {
     bool fine_grained_locking{true};
     GpuAVSettings gpuav_settings = {};
     DebugPrintfSettings printf_settings = {};
+    SyncValSettings syncval_settings = {};
+    uint32_t thread_pool_size = 0;
+    // Report the time spent in each kind of thread pool task at device destruction
+    bool thread_pool_stats = false;
+    // Device scoped, shared by all the validation objects of a device
+    std::shared_ptr<vvl::ThreadPool> thread_pool;
+    // Device scoped like thread_pool, one thread retires the queue submissions of all the validation objects
+    std::shared_ptr<vvl::QueueRetirementScheduler> queue_retirement_scheduler;
 
     VkInstance instance = VK_NULL_HANDLE;
     VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -4646,6 +4646,8 @@ enum class FlagBitmask {
     VkVideoEncodeUsageFlagBitsKHR,
     VkVideoSessionCreateFlagBitsKHR,
 };
+// Allows tables indexed by FlagBitmask
+constexpr uint32_t kFlagBitmaskCount = 135;
 
 // Need underscore prefix to not conflict with namespace, but still easy to match generation
 enum class Extension {
@@ -131,6 +131,8 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         for bitmask in sorted(self.vk.bitmasks.values()):
             out.append(f'    {bitmask.name},\n')
         out.append('};\n')
+        out.append('// Allows tables indexed by FlagBitmask\n')
+        out.append(f'constexpr uint32_t kFlagBitmaskCount = {len(self.vk.bitmasks) + 1};\n')
 
         out.append('\n')
         out.append('// Need underscore prefix to not conflict with namespace, but still easy to match generation\n')
@@ -149,11 +149,11 @@ class SyncValidationOutputGenerator(BaseGenerator):
             #pragma once
 
             #include <array>
-            #include <bitset>
             #include <map>
             #include <stdint.h>
             #include <vulkan/vulkan.h>
             #include "containers/custom_containers.h"
+            #include "sync/sync_access_flags.h"
             ''')
         out.append('// clang-format off\n')
 
@@ -181,10 +181,10 @@ static const VkAccessFlagBits2 VK_ACCESS_2_PRESENT_PRESENTED_BIT_SYNCVAL = 0x{(1
         out.append('\n')
 
         syncStageAccessFlagsSize = 192
-        out.append(f'using SyncStageAccessFlags = std::bitset<{syncStageAccessFlagsSize}>;\n')
+        out.append(f'using SyncStageAccessFlags = SyncAccessBitset<{syncStageAccessFlagsSize}>;\n')
         out.append('// Unique bit for each stage/access combination\n')
         for access in [x for x in self.stageAccessCombo if x['stage_access_bit'] is not None]:
-            out.append(f'static const SyncStageAccessFlags {access["stage_access_bit"]} = (SyncStageAccessFlags(1) << {access["stage_access"]});\n')
+            out.append(f'static constexpr SyncStageAccessFlags {access["stage_access_bit"]} = (SyncStageAccessFlags(1) << {access["stage_access"]});\n')
 
         if len(self.stageAccessCombo) > syncStageAccessFlagsSize:
             print("The bitset is too small, errors will occur, need to increase syncStageAccessFlagsSize\n")
@@ -205,14 +205,14 @@ const std::array<SyncStageAccessInfoType, {len(self.stageAccessCombo)}>& syncSta
 ''')
 
         out.append('// Constants defining the mask of all read and write stage_access states\n')
-        out.append('static const SyncStageAccessFlags syncStageAccessReadMask = ( //  Mask of all read StageAccess bits\n')
+        out.append('static constexpr SyncStageAccessFlags syncStageAccessReadMask = ( //  Mask of all read StageAccess bits\n')
         read_list = [x['stage_access_bit'] for x in self.stageAccessCombo if x['is_read'] is not None and x['is_read'] == 'true']
         out.append('    ')
         out.append(' |\n    '.join(read_list))
         out.append('\n);')
         out.append('\n\n')
 
-        out.append('static const SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all write StageAccess bits\n')
+        out.append('static constexpr SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all write StageAccess bits\n')
         write_list = [x['stage_access_bit'] for x in self.stageAccessCombo if x['is_read'] is not None and x['is_read'] != 'true']
         out.append('    ')
         out.append(' |\n    '.join(write_list))
@@ -269,6 +269,21 @@ class GpuAVTest : public virtual VkLayerTest {
 class NegativeGpuAV : public GpuAVTest {};
 class PositiveGpuAV : public GpuAVTest {};
 
+class GpuAVShaderProfileTest : public GpuAVTest {
+  public:
+    // Inits GPU-AV with the gpuav_shader_profile setting pointing to profile_path
+    void InitGpuAvShaderProfile(const std::string &profile_path);
+    // Hash the shader profile uses for the shader of DrawOutOfBoundsWrite(), available before the device is created
+    uint32_t OutOfBoundsWriteShaderHash();
+    // Draws with a vertex shader writing out of bounds of a storage buffer, once per vertex
+    void DrawOutOfBoundsWrite(uint32_t expected_warnings);
+
+    static std::string GetProfilePath(const char *file_name);
+    static std::string ReadProfile(const std::string &profile_path);
+};
+class NegativeGpuAVShaderProfile : public GpuAVShaderProfileTest {};
+class PositiveGpuAVShaderProfile : public GpuAVShaderProfileTest {};
+
 class GpuAVBufferDeviceAddressTest : public GpuAVTest {
   public:
     void InitGpuVUBufferDeviceAddress(void *p_next = nullptr);
@@ -308,15 +323,18 @@ class PositiveGpuAVRayQuery : public GpuAVRayQueryTest {};
 
 class NegativeDebugPrintf : public VkLayerTest {
   public:
-    void InitDebugPrintfFramework();
+    void InitDebugPrintfFramework(void *p_next = nullptr);
 
   protected:
 };
 
 class VkSyncValTest : public VkLayerTest {
   public:
-    void InitSyncValFramework(bool disable_queue_submit_validation = false);
+    // p_next is chained after the validation features, ex. for a VkLayerSettingsCreateInfoEXT
+    void InitSyncValFramework(bool disable_queue_submit_validation = false, void *p_next = nullptr);
     void InitSyncVal();
+    // InitSyncVal with one uint32 layer setting, ex. "thread_pool_size"
+    void InitSyncValWithSetting(const char *setting_name, uint32_t setting_value);
     void InitTimelineSemaphore();
 
   protected:
@@ -16,6 +16,9 @@
 #include "../framework/descriptor_helper.h"
 #include "../framework/gpu_av_helper.h"
 
+#include <fstream>
+#include <sstream>
+
 TEST_F(NegativeGpuAV, DestroyedPipelineLayout) {
     TEST_DESCRIPTION("Check if can catch pipeline layout not being bound");
     RETURN_IF_SKIP(InitGpuAvFramework());
@@ -181,6 +184,172 @@ TEST_F(NegativeGpuAV, SelectInstrumentedShaders) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeGpuAVShaderProfile, NewShader) {
+    TEST_DESCRIPTION("Shaders not listed in the GPU-AV shader profile are new, and must be instrumented");
+    const std::string profile_path = GetProfilePath("gpuav_shader_profile_new_shader.txt");
+    RETURN_IF_SKIP(InitGpuAvShaderProfile(profile_path));
+    // Robust buffer access will be on by default
+    RETURN_IF_SKIP(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    InitRenderTarget();
+
+    DrawOutOfBoundsWrite(3);
+    ShutdownFramework();
+    std::remove(profile_path.c_str());
+}
+
+TEST_F(NegativeGpuAVShaderProfile, RoundTrip) {
+    TEST_DESCRIPTION("The errors of a run are written back to the GPU-AV shader profile at device destruction");
+    const std::string profile_path = GetProfilePath("gpuav_shader_profile_round_trip.txt");
+    RETURN_IF_SKIP(InitGpuAvShaderProfile(profile_path));
+    const uint32_t shader_hash = OutOfBoundsWriteShaderHash();
+    // A shader with an error history, that is not used during this run, keeps its entry untouched
+    {
+        std::ofstream file_stream(profile_path);
+        file_stream << "0x1 instrument 7 # old shader\n";
+    }
+    RETURN_IF_SKIP(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    InitRenderTarget();
+
+    DrawOutOfBoundsWrite(3);
+    // Write the profile
+    ShutdownFramework();
+
+    std::stringstream shader_line;
+    shader_line << "0x" << std::hex << shader_hash << std::dec << " instrument 3";
+    const std::string profile = ReadProfile(profile_path);
+    ASSERT_NE(profile.find("0x1 instrument 7 # old shader\n"), std::string::npos) << profile;
+    ASSERT_NE(profile.find(shader_line.str()), std::string::npos) << profile;
+    std::remove(profile_path.c_str());
+}
+
+TEST_F(NegativeGpuAVShaderProfile, InvalidProfile) {
+    TEST_DESCRIPTION("A GPU-AV shader profile that cannot be parsed is reported, ignored and never overwritten");
+    const std::string profile_path = GetProfilePath("gpuav_shader_profile_invalid.txt");
+    RETURN_IF_SKIP(InitGpuAvShaderProfile(profile_path));
+    std::stringstream invalid_profile;
+    invalid_profile << "0x" << std::hex << OutOfBoundsWriteShaderHash() << " skip\n";
+    {
+        std::ofstream file_stream(profile_path);
+        file_stream << invalid_profile.str();
+    }
+    m_errorMonitor->SetDesiredWarning("WARNING-GPU-Assisted-Validation");
+    RETURN_IF_SKIP(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    m_errorMonitor->VerifyFound();
+    InitRenderTarget();
+
+    // The "skip" entry was not loaded, the shader is instrumented
+    DrawOutOfBoundsWrite(3);
+    ShutdownFramework();
+
+    ASSERT_EQ(ReadProfile(profile_path), invalid_profile.str());
+    std::remove(profile_path.c_str());
+}
+
+TEST_F(NegativeGpuAV, ErrorDeduplication) {
+    TEST_DESCRIPTION("With error deduplication, an error site hit by every vertex is only reported once per submission");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const VkBool32 value = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_error_deduplication", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+
+    VkPhysicalDeviceFeatures2 features2 = vku::InitStructHelper();
+    GetPhysicalDeviceFeatures2(features2);
+    if (!features2.features.robustBufferAccess) {
+        GTEST_SKIP() << "Not safe to write outside of buffer memory";
+    }
+    // Robust buffer access will be on by default
+    VkCommandPoolCreateFlags pool_flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    InitState(nullptr, nullptr, pool_flags);
+    InitRenderTarget();
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    vkt::Buffer write_buffer(*m_device, 4, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, reqs);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+    static const char vertshader[] = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+                Data.data[4] = 0xdeadca71;
+        }
+        )glsl";
+
+    VkShaderObj vs(this, vertshader, VK_SHADER_STAGE_VERTEX_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_[0] = vs.GetStageCreateInfo();
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_errorMonitor->SetDesiredWarning("VUID-vkCmdDraw-storageBuffers-06936");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeGpuAV, SharedLoadStoreCheck) {
+    TEST_DESCRIPTION("A load and a store through the same access chain indexes are validated by a single check");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    RETURN_IF_SKIP(InitGpuAvFramework());
+
+    VkPhysicalDeviceFeatures2 features2 = vku::InitStructHelper();
+    GetPhysicalDeviceFeatures2(features2);
+    if (!features2.features.robustBufferAccess) {
+        GTEST_SKIP() << "Not safe to write outside of buffer memory";
+    }
+    // Robust buffer access will be on by default
+    VkCommandPoolCreateFlags pool_flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    InitState(nullptr, nullptr, pool_flags);
+    InitRenderTarget();
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    vkt::Buffer write_buffer(*m_device, 4, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, reqs);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+    static const char vertshader[] = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+        void main() {
+                Data.data[4] += 1;
+        }
+        )glsl";
+
+    VkShaderObj vs(this, vertshader, VK_SHADER_STAGE_VERTEX_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_[0] = vs.GetStageCreateInfo();
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    // One error per vertex, the store reuses the result of the load check
+    m_errorMonitor->SetDesiredWarning("VUID-vkCmdDraw-storageBuffers-06936", 3);
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
 // TODO the SPIRV-Tools instrumentation doesn't work for this shader
 // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/6944
 TEST_F(NegativeGpuAV, DISABLED_InvalidAtomicStorageOperation) {
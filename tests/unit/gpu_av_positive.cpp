@@ -20,6 +20,11 @@
 #include "../framework/descriptor_helper.h"
 #include "../framework/gpu_av_helper.h"
 #include "../../layers/gpu_shaders/gpu_shaders_constants.h"
+#include "utils/hash_util.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 
 static const std::array gpu_av_enables = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT,
                                           VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_RESERVE_BINDING_SLOT_EXT};
@@ -1132,4 +1137,100 @@ TEST_F(PositiveGpuAV, AliasImageBinding) {
     m_commandBuffer->end();
     m_default_queue->Submit(*m_commandBuffer);
     vk::DeviceWaitIdle(*m_device);
-}
\ No newline at end of file
+}
+
+static const char kShaderProfileOutOfBoundsWriteVert[] = R"glsl(
+    #version 450
+    layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;
+    void main() {
+            Data.data[4] = 0xdeadca71;
+    }
+    )glsl";
+
+std::string GpuAVShaderProfileTest::GetProfilePath(const char *file_name) {
+    const std::string profile_path = (std::filesystem::temp_directory_path() / file_name).string();
+    std::remove(profile_path.c_str());
+    return profile_path;
+}
+
+std::string GpuAVShaderProfileTest::ReadProfile(const std::string &profile_path) {
+    std::ifstream file_stream(profile_path);
+    std::stringstream contents;
+    contents << file_stream.rdbuf();
+    return contents.str();
+}
+
+void GpuAVShaderProfileTest::InitGpuAvShaderProfile(const std::string &profile_path) {
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const char *setting_values[] = {profile_path.c_str()};
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_shader_profile", VK_LAYER_SETTING_TYPE_STRING_EXT, 1,
+                                       setting_values};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+
+    VkPhysicalDeviceFeatures2 features2 = vku::InitStructHelper();
+    GetPhysicalDeviceFeatures2(features2);
+    if (!features2.features.robustBufferAccess) {
+        GTEST_SKIP() << "Not safe to write outside of buffer memory";
+    }
+}
+
+uint32_t GpuAVShaderProfileTest::OutOfBoundsWriteShaderHash() {
+    std::vector<uint32_t> spv;
+    GLSLtoSPV(&physDevProps().limits, VK_SHADER_STAGE_VERTEX_BIT, kShaderProfileOutOfBoundsWriteVert, spv);
+    return hash_util::ShaderHash(spv.data(), spv.size() * sizeof(uint32_t));
+}
+
+void GpuAVShaderProfileTest::DrawOutOfBoundsWrite(uint32_t expected_warnings) {
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    vkt::Buffer write_buffer(*m_device, 4, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, reqs);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, write_buffer.handle(), 0, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    VkShaderObj vs(this, kShaderProfileOutOfBoundsWriteVert, VK_SHADER_STAGE_VERTEX_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_[0] = vs.GetStageCreateInfo();
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    if (expected_warnings > 0) {
+        m_errorMonitor->SetDesiredWarning("VUID-vkCmdDraw-storageBuffers-06936", expected_warnings);
+    } else {
+        m_errorMonitor->ExpectSuccess(kWarningBit | kErrorBit);
+    }
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    if (expected_warnings > 0) {
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(PositiveGpuAVShaderProfile, SkipShader) {
+    TEST_DESCRIPTION("Shaders marked as skip in the GPU-AV shader profile are not instrumented");
+    const std::string profile_path = GetProfilePath("gpuav_shader_profile_skip_shader.txt");
+    RETURN_IF_SKIP(InitGpuAvShaderProfile(profile_path));
+    {
+        std::ofstream file_stream(profile_path);
+        file_stream << "0x" << std::hex << OutOfBoundsWriteShaderHash() << " skip 0\n";
+    }
+    // Robust buffer access will be on by default
+    RETURN_IF_SKIP(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    InitRenderTarget();
+
+    // The out of bounds write is not reported since the shader is not instrumented
+    DrawOutOfBoundsWrite(0);
+    ShutdownFramework();
+    std::remove(profile_path.c_str());
+}
@@ -697,6 +697,31 @@ TEST_F(VkLayerTest, InvalidStructPNext) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, PnextChainCycle) {
+    TEST_DESCRIPTION("Use a pNext chain that loops back on itself");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(Init());
+
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkMemoryAllocateFlagsInfo flags_info = vku::InitStructHelper();
+    VkMemoryAllocateInfo memory_alloc_info = vku::InitStructHelper(&flags_info);
+    memory_alloc_info.allocationSize = 256;
+
+    // A structure pointing to itself
+    flags_info.pNext = &flags_info;
+    m_errorMonitor->SetDesiredError("UNASSIGNED-GeneralParameterError-PNextChainCycle");
+    vk::AllocateMemory(device(), &memory_alloc_info, nullptr, &memory);
+    m_errorMonitor->VerifyFound();
+
+    // The loop goes back to the first structure of the chain, which is then also seen twice
+    VkMemoryDedicatedAllocateInfo dedicated_info = vku::InitStructHelper(&flags_info);
+    flags_info.pNext = &dedicated_info;
+    m_errorMonitor->SetDesiredError("VUID-VkMemoryAllocateInfo-sType-unique");
+    m_errorMonitor->SetDesiredError("UNASSIGNED-GeneralParameterError-PNextChainCycle");
+    vk::AllocateMemory(device(), &memory_alloc_info, nullptr, &memory);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, UnrecognizedValueOutOfRange) {
     RETURN_IF_SKIP(Init());
 
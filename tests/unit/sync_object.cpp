@@ -3248,6 +3248,30 @@ TEST_F(NegativeSyncObject, EventStageMaskTwoCommandBufferFail) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSyncObject, EventStageMaskSecondaryCommandBufferFail) {
+    TEST_DESCRIPTION("The submit time event validation of a secondary runs when the primary executing it is submitted");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Event event(*m_device);
+
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    // wrong srcStageMask
+    vk::CmdWaitEvents(secondary.handle(), 1, &event.handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, nullptr, 0, nullptr, 0, nullptr);
+    secondary.end();
+
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(m_commandBuffer->handle(), event.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+    vk::CmdExecuteCommands(m_commandBuffer->handle(), 1, &secondary.handle());
+    m_commandBuffer->end();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdWaitEvents-srcStageMask-parameter");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSyncObject, DetectInterQueueEventUsage) {
     TEST_DESCRIPTION("Sets event on one queue and tries to wait on a different queue (CmdSetEvent/CmdWaitEvents)");
     all_queue_count_ = true;
@@ -509,6 +509,41 @@ TEST_F(PositiveSyncObject, TwoQueueSubmitsSeparateQueuesWithTimelineSemaphoreAnd
     vk::WaitForFences(device(), 1, &fence.handle(), VK_TRUE, kWaitTimeout);
 }
 
+TEST_F(PositiveSyncObject, TwoQueuesWaitIdleOnlyOnWaitingQueue) {
+    TEST_DESCRIPTION(
+        "A queue waits for timeline values signaled by a second queue, only the waiting queue is waited for. The state of the "
+        "waiting queue can only be retired once the second queue is requested to retire its signals.");
+
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    all_queue_count_ = true;
+    RETURN_IF_SKIP(Init());
+    if ((m_second_queue_caps & VK_QUEUE_GRAPHICS_BIT) == 0) {
+        GTEST_SKIP() << "2 graphics queues are needed";
+    }
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    vkt::CommandPool pool0(*m_device, m_second_queue->family_index);
+    vkt::CommandBuffer cb0(*m_device, pool0);
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+
+    cb0.begin();
+    vk::CmdPipelineBarrier(cb0.handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0,
+                           nullptr, 0, nullptr);
+    cb0.end();
+    cb1.begin();
+    cb1.end();
+
+    for (uint64_t i = 0; i < 4; ++i) {
+        const uint64_t wait_value = 2 * i + 1;
+        // The wait is submitted first and is satisfied by a larger value
+        m_default_queue->SubmitWithTimelineSemaphore(cb1, vkt::wait, semaphore, wait_value);
+        m_second_queue->SubmitWithTimelineSemaphore(cb0, vkt::signal, semaphore, wait_value + 1);
+        m_default_queue->Wait();
+    }
+    m_device->Wait();
+}
+
 TEST_F(PositiveSyncObject, TwoQueueSubmitsOneQueueWithSemaphoreAndOneFence) {
     TEST_DESCRIPTION(
         "Two command buffers, each in a separate QueueSubmit call on the same queue, sharing a signal/wait semaphore, the second "
@@ -1089,6 +1124,32 @@ TEST_F(PositiveSyncObject, BasicSetAndWaitEvent) {
     m_device->Wait();
 }
 
+TEST_F(PositiveSyncObject, SetAndWaitEventSecondaryCommandBuffer) {
+    TEST_DESCRIPTION("Submit time event validation of a secondary executed after events used by the primary");
+    RETURN_IF_SKIP(Init());
+
+    const vkt::Event primary_event(*m_device);
+    const vkt::Event secondary_event(*m_device);
+
+    // The wait of the secondary must be checked against its own event, not the first event of the primary
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    vk::CmdSetEvent(secondary, secondary_event, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+    vk::CmdWaitEvents(secondary, 1, &secondary_event.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                      VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, nullptr, 0, nullptr, 0, nullptr);
+    secondary.end();
+
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(*m_commandBuffer, primary_event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    vk::CmdWaitEvents(*m_commandBuffer, 1, &primary_event.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT,
+                      VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0, nullptr, 0, nullptr, 0, nullptr);
+    vk::CmdExecuteCommands(*m_commandBuffer, 1, &secondary.handle());
+    m_commandBuffer->end();
+
+    m_default_queue->Submit(*m_commandBuffer);
+    m_device->Wait();
+}
+
 TEST_F(PositiveSyncObject, BasicSetAndWaitEvent2) {
     TEST_DESCRIPTION("Sets event and then wait for it using CmdSetEvent2/CmdWaitEvents2");
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -11,6 +11,7 @@
  *     http://www.apache.org/licenses/LICENSE-2.0
  */
 
+#include <sstream>
 #include <type_traits>
 
 #include "utils/cast_utils.h"
@@ -2976,6 +2977,108 @@ TEST_F(NegativeSyncVal, LayoutTransition) {
     m_commandBuffer->end();
 }
 
+TEST_F(NegativeSyncVal, LayoutTransitionAfterPendingGlobalBarrier) {
+    TEST_DESCRIPTION("Layout transition not chained with an earlier global barrier that the image was not used after");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    constexpr VkDeviceSize buffer_size = 64 * 64 * 4;
+    vkt::Buffer buffer(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Image image(*m_device, 64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM,
+                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {64, 64, 1};
+
+    // Makes the write available, but the dependency chain ends in the fragment shader stage
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+    memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.dstAccessMask = 0;
+
+    VkImageMemoryBarrier image_barrier = vku::InitStructHelper();
+    image_barrier.srcAccessMask = 0;
+    image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.image = image;
+    image_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+    m_command_buffer.begin();
+    vk::CmdCopyBufferToImage(m_command_buffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1,
+                           &memory_barrier, 0, nullptr, 0, nullptr);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                           nullptr, 1, &image_barrier);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.end();
+}
+
+TEST_F(NegativeSyncVal, GlobalBarrierUntouchedAccessAtSubmit) {
+    TEST_DESCRIPTION("Global barrier that does not cover a later read is not applied as if it did when resolved at submit");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_d(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    // Wrong destination scope for the transfer read of buffer_b below
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    m_command_buffer.begin();
+    m_command_buffer.Copy(buffer_c, buffer_b);
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1, &barrier,
+                           0, nullptr, 0, nullptr);
+    // buffer_b is left as it was when the barrier was recorded
+    m_command_buffer.Copy(buffer_c, buffer_a);
+    m_command_buffer.end();
+
+    vkt::CommandBuffer command_buffer2(*m_device, m_command_pool);
+    command_buffer2.begin();
+    command_buffer2.Copy(buffer_b, buffer_d);
+    command_buffer2.end();
+
+    VkCommandBuffer cbs[2] = {m_command_buffer, command_buffer2};
+    VkSubmitInfo submit = vku::InitStructHelper();
+    submit.commandBufferCount = 2;
+    submit.pCommandBuffers = cbs;
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    vk::QueueSubmit(*m_default_queue, 1, &submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
+TEST_F(NegativeSyncVal, GlobalBarrierPendingInExecutedCommands) {
+    TEST_DESCRIPTION("Pending global barrier of a secondary command buffer that does not cover a read in the primary");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    secondary.Copy(buffer_b, buffer_a);
+    vk::CmdPipelineBarrier(secondary, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 1, &barrier, 0,
+                           nullptr, 0, nullptr);
+    secondary.end();
+
+    m_command_buffer.begin();
+    vk::CmdExecuteCommands(m_command_buffer, 1, &secondary.handle());
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    m_command_buffer.Copy(buffer_a, buffer_c);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.end();
+}
+
 TEST_F(NegativeSyncVal, SubpassMultiDep) {
     RETURN_IF_SKIP(InitSyncValFramework());
     RETURN_IF_SKIP(InitState());
@@ -3479,6 +3582,114 @@ TEST_F(NegativeSyncVal, RenderPassAsyncHazard) {
     }
 }
 
+TEST_F(NegativeSyncVal, SubpassBarriersAfterReRecord) {
+    TEST_DESCRIPTION("Hazards of a multi-subpass render pass do not change when command buffers are reset and re-recorded");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    const VkImageUsageFlags usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    vkt::Image image_a(*m_device, 32, 32, 1, format, usage);
+    image_a.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+    vkt::Image image_b(*m_device, 32, 32, 1, format, usage);
+    image_b.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+    // Not an attachment, its accesses must survive the resolve of the subpass contexts
+    vkt::Image image_c(*m_device, 32, 32, 1, format, usage);
+    image_c.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+    vkt::ImageView view_a = image_a.CreateView();
+    vkt::ImageView view_b = image_b.CreateView();
+
+    std::array<VkAttachmentDescription, 2> attachments{};
+    for (auto& attachment : attachments) {
+        attachment.format = format;
+        attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+        attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachment.initialLayout = VK_IMAGE_LAYOUT_GENERAL;
+        attachment.finalLayout = VK_IMAGE_LAYOUT_GENERAL;
+    }
+    const VkAttachmentReference ref_a = {0, VK_IMAGE_LAYOUT_GENERAL};
+    const VkAttachmentReference ref_b = {1, VK_IMAGE_LAYOUT_GENERAL};
+
+    // subpass 0 writes image A, subpass 1 writes image B
+    std::array<VkSubpassDescription, 2> subpasses{};
+    subpasses[0].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpasses[0].colorAttachmentCount = 1;
+    subpasses[0].pColorAttachments = &ref_a;
+    subpasses[1].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpasses[1].colorAttachmentCount = 1;
+    subpasses[1].pColorAttachments = &ref_b;
+
+    // Only the store of subpass 0 is synchronized with the transfers after the render pass
+    const VkSubpassDependency dependency = {0,
+                                            VK_SUBPASS_EXTERNAL,
+                                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                            VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                                            VK_ACCESS_TRANSFER_WRITE_BIT,
+                                            0};
+
+    VkRenderPassCreateInfo renderpass_info = vku::InitStructHelper();
+    renderpass_info.attachmentCount = attachments.size();
+    renderpass_info.pAttachments = attachments.data();
+    renderpass_info.subpassCount = subpasses.size();
+    renderpass_info.pSubpasses = subpasses.data();
+    renderpass_info.dependencyCount = 1;
+    renderpass_info.pDependencies = &dependency;
+    vkt::RenderPass rp(*m_device, renderpass_info);
+
+    const VkImageView views[2] = {view_a, view_b};
+    vkt::Framebuffer fb(*m_device, rp.handle(), 2, views);
+
+    const VkClearColorValue clear_color{};
+    const VkImageSubresourceRange full_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    VkMemoryBarrier full_barrier = vku::InitStructHelper();
+    full_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    full_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+    // Two render pass instances per recording, so a re-recording takes all its render pass contexts from the recycled ones
+    auto record = [&](vkt::CommandBuffer& cb) {
+        cb.begin();
+        for (int instance = 0; instance < 2; instance++) {
+            vk::CmdClearColorImage(cb, image_c, VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &full_range);
+            cb.BeginRenderPass(rp.handle(), fb.handle(), 32, 32);
+            cb.NextSubpass();
+            cb.EndRenderPass();
+
+            vk::CmdClearColorImage(cb, image_a, VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &full_range);
+
+            m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+            vk::CmdClearColorImage(cb, image_b, VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &full_range);
+            m_errorMonitor->VerifyFound();
+
+            m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+            vk::CmdClearColorImage(cb, image_c, VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &full_range);
+            m_errorMonitor->VerifyFound();
+
+            vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &full_barrier,
+                                   0, nullptr, 0, nullptr);
+        }
+        cb.end();
+    };
+
+    vkt::CommandBuffer other_cb(*m_device, m_command_pool);
+    for (int iteration = 0; iteration < 2; iteration++) {
+        record(m_command_buffer);
+        // Records the same render pass, with the subpass barriers built by the first command buffer
+        record(other_cb);
+
+        m_default_queue->Submit(m_command_buffer);
+        m_default_queue->Wait();
+        m_default_queue->Submit(other_cb);
+        m_default_queue->Wait();
+
+        m_command_buffer.reset();
+        other_cb.reset();
+    }
+}
+
 TEST_F(NegativeSyncVal, EventsBufferCopy) {
     TEST_DESCRIPTION("Check Set/Wait protection for a variety of use cases using buffer copies");
     RETURN_IF_SKIP(InitSyncValFramework());
@@ -4514,6 +4725,82 @@ TEST_F(NegativeSyncVal, QSBufferCopyHazards) {
     test.DeviceWait();
 }
 
+TEST_F(NegativeSyncVal, QSBufferCopyManyRegions) {
+    TEST_DESCRIPTION("Submit time hazard against the last of many recorded accesses, large enough to be checked in parallel");
+    // Use worker threads even on single core machines, where the default size is 0
+    RETURN_IF_SKIP(InitSyncValWithSetting("thread_pool_size", 3));
+
+    // Every other 4 byte word is copied so each region is a separate recorded access
+    constexpr uint32_t region_count = 4096;
+    constexpr VkDeviceSize size = region_count * 8;
+    vkt::Buffer src_buffer(*m_device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer dst_buffer(*m_device, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    std::vector<VkBufferCopy> regions(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        regions[i] = {i * 8u, i * 8u, 4};
+    }
+
+    vkt::CommandBuffer cb0(*m_device, m_command_pool);
+    cb0.begin();
+    vk::CmdCopyBuffer(cb0, src_buffer, dst_buffer, 1, &regions.back());
+    cb0.end();
+
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+    cb1.begin();
+    vk::CmdCopyBuffer(cb1, src_buffer, dst_buffer, region_count, regions.data());
+    cb1.end();
+
+    VkCommandBuffer cbs[2] = {cb0, cb1};
+    VkSubmitInfo submit = vku::InitStructHelper();
+    submit.commandBufferCount = 2;
+    submit.pCommandBuffers = cbs;
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::QueueSubmit(*m_default_queue, 1, &submit, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
+TEST_F(NegativeSyncVal, UsageLogBudgetRetiresOldBatches) {
+    TEST_DESCRIPTION("Hazard against a batch whose usage information was released to stay within syncval_usage_log_budget");
+    RETURN_IF_SKIP(InitSyncValWithSetting("syncval_usage_log_budget", 1));
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const VkBufferCopy region = {0, 0, 256};
+
+    vkt::CommandBuffer cb_write(*m_device, m_command_pool);
+    cb_write.begin();
+    vk::CmdCopyBuffer(cb_write, buffer_b, buffer_a, 1, &region);
+    cb_write.end();
+
+    // Each command gets a usage record, enough of them exceed the 1 MB budget. The barriers have an empty first scope so they
+    // do not synchronize with the write above.
+    constexpr uint32_t barrier_count = 65536;
+    vkt::CommandBuffer cb_barriers(*m_device, m_command_pool);
+    cb_barriers.begin();
+    for (uint32_t i = 0; i < barrier_count; ++i) {
+        vk::CmdPipelineBarrier(cb_barriers, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0,
+                               nullptr, 0, nullptr, 0, nullptr);
+    }
+    cb_barriers.end();
+
+    vkt::CommandBuffer cb_read(*m_device, m_command_pool);
+    cb_read.begin();
+    vk::CmdCopyBuffer(cb_read, buffer_a, buffer_c, 1, &region);
+    cb_read.end();
+
+    m_default_queue->Submit(cb_write);
+    // Over budget: the write batch is no longer the last batch of the queue, its usage information is released
+    m_default_queue->Submit(cb_barriers);
+
+    // The read-after-write hazard is still reported, but only with the batch information of the write
+    m_errorMonitor->SetDesiredError("usage information released");
+    m_default_queue->Submit(cb_read);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSyncVal, QSSubmit2) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     AddRequiredFeature(vkt::Feature::synchronization2);
@@ -5157,6 +5444,391 @@ TEST_F(NegativeSyncVal, WriteOnlyBufferWriteHazard) {
     m_commandBuffer->end();
 }
 
+TEST_F(NegativeSyncVal, DescriptorFootprintReusedAcrossDispatches) {
+    TEST_DESCRIPTION("Dispatches with the same pipeline and sets validate and record the same descriptor accesses");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buf_a(*m_device, 128, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buf_b(*m_device, 128, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    descriptor_set.WriteDescriptorBufferInfo(0, buf_b, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char* cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) writeonly buffer buf_b { uint values_b[]; };
+        void main(){
+            values_b[0] = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateComputePipeline();
+
+    VkBufferCopy region{};
+    region.size = 128;
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1, &descriptor_set.set_,
+                              0, nullptr);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+
+    // Validated with the accesses of the first dispatch
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    // Recorded with them too
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBuffer(*m_commandBuffer, buf_a, buf_b, 1, &region);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, DescriptorFootprintAfterDescriptorUpdate) {
+    TEST_DESCRIPTION("Updating a bound descriptor set between two dispatches changes the validated descriptor accesses");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::descriptorBindingUpdateUnusedWhilePending);
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buf_a(*m_device, 128, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    vkt::Buffer buf_b(*m_device, 128, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    vkt::Buffer buf_c(*m_device, 128, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    // The binding can be updated without invalidating the command buffer it is bound in
+    const VkDescriptorBindingFlags binding_flags = VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_ci = vku::InitStructHelper();
+    binding_flags_ci.bindingCount = 1;
+    binding_flags_ci.pBindingFlags = &binding_flags;
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}},
+                                       0, &binding_flags_ci);
+    descriptor_set.WriteDescriptorBufferInfo(0, buf_a, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char* cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) writeonly buffer buf { uint values[]; };
+        void main(){
+            values[0] = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateComputePipeline();
+
+    VkBufferCopy region{};
+    region.size = 128;
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1, &descriptor_set.set_,
+                              0, nullptr);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+
+    descriptor_set.Clear();
+    descriptor_set.WriteDescriptorBufferInfo(0, buf_b, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    // Writes buf_b, no hazard with the write of buf_a by the first dispatch
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBuffer(*m_commandBuffer, buf_c, buf_b, 1, &region);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, DescriptorFootprintAfterSetRebind) {
+    TEST_DESCRIPTION("Binding a different descriptor set between two dispatches changes the validated descriptor accesses");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buf_a(*m_device, 128, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    vkt::Buffer buf_b(*m_device, 128, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    OneOffDescriptorSet descriptor_set_a(m_device,
+                                         {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    descriptor_set_a.WriteDescriptorBufferInfo(0, buf_a, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set_a.UpdateDescriptorSets();
+    OneOffDescriptorSet descriptor_set_b(m_device,
+                                         {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    descriptor_set_b.WriteDescriptorBufferInfo(0, buf_b, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set_b.UpdateDescriptorSets();
+
+    const char* cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) writeonly buffer buf { uint values[]; };
+        void main(){
+            values[0] = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set_a.layout_});
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1,
+                              &descriptor_set_a.set_, 0, nullptr);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+
+    // Writes buf_b, no hazard with the write of buf_a by the first dispatch
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1,
+                              &descriptor_set_b.set_, 0, nullptr);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1,
+                              &descriptor_set_a.set_, 0, nullptr);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, DescriptorFootprintSparseBufferBoundLater) {
+    TEST_DESCRIPTION("A sparse buffer descriptor becomes valid when the buffer is fully bound, without any descriptor update");
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    VkBufferCreateInfo buffer_ci = vkt::Buffer::create_info(128, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    buffer_ci.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    vkt::Buffer sparse_buffer(*m_device, buffer_ci, vkt::no_mem);
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    descriptor_set.WriteDescriptorBufferInfo(0, sparse_buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char* cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) writeonly buffer buf { uint values[]; };
+        void main(){
+            values[0] = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1, &descriptor_set.set_,
+                              0, nullptr);
+    // The buffer is not bound to memory yet, the access is not tracked
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+
+    VkMemoryRequirements buffer_mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), sparse_buffer.handle(), &buffer_mem_reqs);
+    vkt::DeviceMemory buffer_mem(
+        *m_device, vkt::DeviceMemory::get_resource_alloc_info(*m_device, buffer_mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT));
+
+    VkSparseMemoryBind buffer_memory_bind = {};
+    buffer_memory_bind.size = buffer_mem_reqs.size;
+    buffer_memory_bind.memory = buffer_mem.handle();
+    VkSparseBufferMemoryBindInfo buffer_memory_bind_info = {};
+    buffer_memory_bind_info.buffer = sparse_buffer.handle();
+    buffer_memory_bind_info.bindCount = 1;
+    buffer_memory_bind_info.pBinds = &buffer_memory_bind;
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = 1;
+    bind_info.pBufferBinds = &buffer_memory_bind_info;
+    VkQueue sparse_queue = m_device->QueuesWithSparseCapability()[0]->handle();
+    vk::QueueBindSparse(sparse_queue, 1, &bind_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(sparse_queue);
+
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, DescriptorBufferWriteHazard) {
+    TEST_DESCRIPTION("Hazard for a storage buffer accessed through a descriptor buffer");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::descriptorBuffer);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptor_buffer_properties = vku::InitStructHelper();
+    GetPhysicalDeviceProperties2(descriptor_buffer_properties);
+
+    VkMemoryAllocateFlagsInfo allocate_flag_info = vku::InitStructHelper();
+    allocate_flag_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    vkt::Buffer buf_a(*m_device, 128, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buf_b(*m_device, 128,
+                      VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                          VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                      0, &allocate_flag_info);
+    vkt::Buffer descriptor_buffer(*m_device, 4096,
+                                  VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &allocate_flag_info);
+
+    const VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    const vkt::DescriptorSetLayout set_layout(*m_device, {binding}, VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    // Write the descriptor into the mapped descriptor buffer, at the offset of its binding
+    VkDeviceSize binding_offset = 0;
+    vk::GetDescriptorSetLayoutBindingOffsetEXT(device(), set_layout.handle(), 0, &binding_offset);
+    VkDescriptorAddressInfoEXT address_info = vku::InitStructHelper();
+    address_info.address = buf_b.address();
+    address_info.range = 128;
+    VkDescriptorGetInfoEXT get_info = vku::InitStructHelper();
+    get_info.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    get_info.data.pStorageBuffer = &address_info;
+    auto *descriptor_data = static_cast<uint8_t *>(descriptor_buffer.memory().map());
+    vk::GetDescriptorEXT(device(), &get_info, descriptor_buffer_properties.storageBufferDescriptorSize,
+                         descriptor_data + binding_offset);
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) writeonly buffer buf_b { uint values_b[]; };
+        void main(){
+            values_b[0] = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&set_layout});
+    pipe.cp_ci_.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    pipe.CreateComputePipeline();
+
+    VkDescriptorBufferBindingInfoEXT buffer_binding_info = vku::InitStructHelper();
+    buffer_binding_info.address = descriptor_buffer.address();
+    buffer_binding_info.usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT;
+    const uint32_t buffer_index = 0;
+    const VkDeviceSize set_offset = 0;
+
+    VkBufferCopy region{};
+    region.size = 128;
+
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(*m_commandBuffer, buf_a, buf_b, 1, &region);
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorBuffersEXT(*m_commandBuffer, 1, &buffer_binding_info);
+    vk::CmdSetDescriptorBufferOffsetsEXT(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1,
+                                         &buffer_index, &set_offset);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_commandBuffer->end();
+
+    // The descriptor data is read when the dispatch executes, the hazard is reported at submit time
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+    descriptor_buffer.memory().unmap();
+}
+
+TEST_F(NegativeSyncVal, DescriptorBufferDataCopiedBetweenDispatches) {
+    TEST_DESCRIPTION("The descriptor in a descriptor buffer is replaced after recording by copying its bytes");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::descriptorBuffer);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptor_buffer_properties = vku::InitStructHelper();
+    GetPhysicalDeviceProperties2(descriptor_buffer_properties);
+    const size_t descriptor_size = descriptor_buffer_properties.storageBufferDescriptorSize;
+
+    VkMemoryAllocateFlagsInfo allocate_flag_info = vku::InitStructHelper();
+    allocate_flag_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    const VkBufferUsageFlags storage_usage =
+        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    vkt::Buffer buf_a(*m_device, 128, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buf_b(*m_device, 128, storage_usage, 0, &allocate_flag_info);
+    vkt::Buffer buf_c(*m_device, 128, storage_usage, 0, &allocate_flag_info);
+    vkt::Buffer descriptor_buffer(*m_device, 4096,
+                                  VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &allocate_flag_info);
+
+    const VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    const vkt::DescriptorSetLayout set_layout(*m_device, {binding}, VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT);
+    VkDeviceSize binding_offset = 0;
+    vk::GetDescriptorSetLayoutBindingOffsetEXT(device(), set_layout.handle(), 0, &binding_offset);
+
+    // The descriptor of buf_b is written in the descriptor buffer, the one of buf_c is kept aside
+    VkDescriptorAddressInfoEXT address_info = vku::InitStructHelper();
+    address_info.range = 128;
+    VkDescriptorGetInfoEXT get_info = vku::InitStructHelper();
+    get_info.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    get_info.data.pStorageBuffer = &address_info;
+    auto *descriptor_data = static_cast<uint8_t *>(descriptor_buffer.memory().map());
+    address_info.address = buf_b.address();
+    vk::GetDescriptorEXT(device(), &get_info, descriptor_size, descriptor_data + binding_offset);
+    std::vector<uint8_t> buf_c_descriptor(descriptor_size);
+    address_info.address = buf_c.address();
+    vk::GetDescriptorEXT(device(), &get_info, descriptor_size, buf_c_descriptor.data());
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) writeonly buffer buf { uint values[]; };
+        void main(){
+            values[0] = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&set_layout});
+    pipe.cp_ci_.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    pipe.CreateComputePipeline();
+
+    VkDescriptorBufferBindingInfoEXT buffer_binding_info = vku::InitStructHelper();
+    buffer_binding_info.address = descriptor_buffer.address();
+    buffer_binding_info.usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT;
+    const uint32_t buffer_index = 0;
+    const VkDeviceSize set_offset = 0;
+
+    VkBufferCopy region{};
+    region.size = 128;
+
+    // Synchronizes the shader writes of the dispatches, not the copy
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+
+    // Recorded while the descriptor buffer holds the descriptor of buf_b, no hazard with the copy to buf_c
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(*m_commandBuffer, buf_a, buf_c, 1, &region);
+    vk::CmdBindPipeline(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorBuffersEXT(*m_commandBuffer, 1, &buffer_binding_info);
+    vk::CmdSetDescriptorBufferOffsetsEXT(*m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1,
+                                         &buffer_index, &set_offset);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                           &barrier, 0, nullptr, 0, nullptr);
+    vk::CmdDispatch(*m_commandBuffer, 1, 1, 1);
+    m_commandBuffer->end();
+
+    // Same set address and no new vkGetDescriptorEXT, only the descriptor bytes tell that both dispatches write buf_c when
+    // they execute. The first dispatch is not synchronized with the copy, the second one is with the first dispatch.
+    memcpy(descriptor_data + binding_offset, buf_c_descriptor.data(), descriptor_size);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+    descriptor_buffer.memory().unmap();
+}
+
 TEST_F(NegativeSyncVal, WriteOnlyImageWriteHazard) {
     TEST_DESCRIPTION("Test that writeonly image access is reported as WRITE access");
     RETURN_IF_SKIP(InitSyncValFramework());
@@ -5428,6 +6100,114 @@ TEST_F(NegativeSyncVal, DebugRegion_Secondary2) {
     m_commandBuffer->end();
 }
 
+TEST_F(NegativeSyncVal, ReportImageSubresource) {
+    TEST_DESCRIPTION("Report the subresource where an image hazard was found");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    vkt::Image image(*m_device, vkt::Image::ImageCreateInfo2D(32, 32, 1, 2, format, VK_IMAGE_USAGE_TRANSFER_DST_BIT));
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+    vkt::Buffer buffer(*m_device, 32 * 32 * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 1};
+    region.imageExtent = {32, 32, 1};
+
+    m_commandBuffer->begin();
+    vk::CmdCopyBufferToImage(*m_commandBuffer, buffer, image, VK_IMAGE_LAYOUT_GENERAL, 1, &region);
+    m_errorMonitor->SetDesiredError("array_layer: 1");
+    vk::CmdCopyBufferToImage(*m_commandBuffer, buffer, image, VK_IMAGE_LAYOUT_GENERAL, 1, &region);
+    m_errorMonitor->VerifyFound();  // SYNC-HAZARD-WRITE-AFTER-WRITE error message
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, ReportRenderPassContext) {
+    TEST_DESCRIPTION("Report the render pass instance of a prior access, rebuilt from the access log");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    vkt::Image image(*m_device, m_width, m_height, 1, format,
+                     VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    auto image_view = image.CreateView();
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+
+    // The final layout transition is a subcommand of vkCmdEndRenderPass
+    RenderPassSingleSubpass rp(*this);
+    rp.AddAttachmentDescription(format, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    rp.AddAttachmentReference({0, VK_IMAGE_LAYOUT_GENERAL});
+    rp.AddColorAttachment(0);
+    rp.CreateRenderPass();
+    vkt::Framebuffer fb(*m_device, rp.Handle(), 1, &image_view.handle());
+
+    vkt::Buffer buffer(*m_device, m_width * m_height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {m_width, m_height, 1};
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(rp.Handle(), fb.handle());
+    m_commandBuffer->EndRenderPass();
+
+    // The transition record has no handle, the render pass is taken from the vkCmdEndRenderPass record. The subpass and the
+    // command index come from the vkCmdBeginRenderPass record.
+    std::stringstream expected;
+    expected << "command: vkCmdEndRenderPass, seq_no: 2, subcmd: 1, renderpass: VkRenderPass 0x" << std::hex
+             << CastToUint64(rp.Handle()) << "[], reset_no: 1, subpass: 0, render_pass_cmd: 1";
+    m_errorMonitor->SetDesiredError(expected.str().c_str());
+    vk::CmdCopyBufferToImage(*m_commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    m_errorMonitor->VerifyFound();  // SYNC-HAZARD-WRITE-AFTER-WRITE error message
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, QSReportRenderPassContext) {
+    TEST_DESCRIPTION("Report the command buffer and render pass instance of a prior access from another command buffer");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    vkt::Image image(*m_device, m_width, m_height, 1, format,
+                     VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    auto image_view = image.CreateView();
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+
+    RenderPassSingleSubpass rp(*this);
+    rp.AddAttachmentDescription(format, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    rp.AddAttachmentReference({0, VK_IMAGE_LAYOUT_GENERAL});
+    rp.AddColorAttachment(0);
+    rp.CreateRenderPass();
+    vkt::Framebuffer fb(*m_device, rp.Handle(), 1, &image_view.handle());
+
+    vkt::Buffer buffer(*m_device, m_width * m_height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {m_width, m_height, 1};
+
+    vkt::CommandBuffer cb0(*m_device, m_command_pool);
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+
+    cb0.begin();
+    cb0.BeginRenderPass(rp.Handle(), fb.handle());
+    cb0.EndRenderPass();
+    cb0.end();
+
+    cb1.begin();
+    vk::CmdCopyBufferToImage(cb1, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    cb1.end();
+
+    // The submit time report names the command buffer of the prior access, the rest is rebuilt from the log of cb0
+    std::stringstream expected;
+    expected << "command: vkCmdEndRenderPass, command_buffer: VkCommandBuffer 0x" << std::hex << CastToUint64(cb0.handle())
+             << "[], seq_no: 2, subcmd: 1, renderpass: VkRenderPass 0x" << CastToUint64(rp.Handle())
+             << "[], reset_no: 1, subpass: 0, render_pass_cmd: 1";
+    std::array command_buffers = {&cb0, &cb1};
+    m_errorMonitor->SetDesiredError(expected.str().c_str());
+    m_default_queue->Submit(command_buffers);
+    m_errorMonitor->VerifyFound();  // SYNC-HAZARD-WRITE-AFTER-WRITE error message
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSyncVal, QSDebugRegion) {
     TEST_DESCRIPTION("Prior access debug region reporting: single debug region per command buffer");
 
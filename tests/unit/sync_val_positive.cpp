@@ -20,9 +20,9 @@
 
 class PositiveSyncVal : public VkSyncValTest {};
 
-void VkSyncValTest::InitSyncValFramework(bool disable_queue_submit_validation) {
+void VkSyncValTest::InitSyncValFramework(bool disable_queue_submit_validation, void *p_next) {
     // Enable synchronization validation
-    features_ = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, nullptr, 1u, enables_, 4, disables_};
+    features_ = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, p_next, 1u, enables_, 4, disables_};
 
     // Optionally enable core validation (by disabling nothing)
     if (!m_syncval_disable_core) {
@@ -36,7 +36,7 @@ void VkSyncValTest::InitSyncValFramework(bool disable_queue_submit_validation) {
     // The pNext of qs_settings is modified by InitFramework that's why it can't
     // be static (should be separate instance per stack frame). Also we show
     // explicitly that it's not const (InitFramework casts const pNext to non-const).
-    VkLayerSettingsCreateInfoEXT qs_settings{VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+    VkLayerSettingsCreateInfoEXT qs_settings{VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, p_next,
                                              static_cast<uint32_t>(std::size(settings)), settings};
     if (disable_queue_submit_validation) {
         features_.pNext = &qs_settings;
@@ -49,6 +49,14 @@ void VkSyncValTest::InitSyncVal() {
     RETURN_IF_SKIP(InitState());
 }
 
+void VkSyncValTest::InitSyncValWithSetting(const char *setting_name, uint32_t setting_value) {
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, setting_name, VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &setting_value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitSyncValFramework(false, &layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+}
+
 void VkSyncValTest::InitTimelineSemaphore() {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     AddRequiredFeature(vkt::Feature::synchronization2);
@@ -1546,3 +1554,166 @@ TEST_F(PositiveSyncVal, SignalUnsignalSignalSingleSubmit) {
     vk::QueueSubmit2(*m_default_queue, 3, submits, VK_NULL_HANDLE);
     m_default_queue->Wait();
 }
+
+TEST_F(PositiveSyncVal, GlobalBarrierUntouchedAccessAtSubmit) {
+    TEST_DESCRIPTION("Global barrier applies to an access that is not used again in the command buffer that recorded the barrier");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_d(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_e(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+    m_command_buffer.begin();
+    m_command_buffer.Copy(buffer_c, buffer_a);
+    m_command_buffer.Copy(buffer_c, buffer_b);
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                           nullptr, 0, nullptr);
+    // Only buffer_a is used after the barrier, buffer_b is left as it was when the barrier was recorded
+    m_command_buffer.Copy(buffer_a, buffer_d);
+    m_command_buffer.end();
+
+    vkt::CommandBuffer command_buffer2(*m_device, m_command_pool);
+    command_buffer2.begin();
+    command_buffer2.Copy(buffer_b, buffer_e);
+    command_buffer2.end();
+
+    VkCommandBuffer cbs[2] = {m_command_buffer, command_buffer2};
+    VkSubmitInfo submit = vku::InitStructHelper();
+    submit.commandBufferCount = 2;
+    submit.pCommandBuffers = cbs;
+    vk::QueueSubmit(*m_default_queue, 1, &submit, VK_NULL_HANDLE);
+    m_default_queue->Wait();
+}
+
+TEST_F(PositiveSyncVal, GlobalBarrierWithLayoutTransition) {
+    TEST_DESCRIPTION("Global memory barrier and image layout transition in the same pipeline barrier");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    constexpr VkDeviceSize buffer_size = 64 * 64 * 4;
+    vkt::Buffer buffer_a(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_d(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_e(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Image image(*m_device, 64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM,
+                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {64, 64, 1};
+
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+    memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+    VkImageMemoryBarrier image_barrier = vku::InitStructHelper();
+    image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.image = image;
+    image_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+    m_command_buffer.begin();
+    vk::CmdCopyBufferToImage(m_command_buffer, buffer_a, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    m_command_buffer.Copy(buffer_a, buffer_b);
+    // The global barrier covers buffer_b, the image barrier transitions the image
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                           &memory_barrier, 0, nullptr, 1, &image_barrier);
+    vk::CmdCopyImageToBuffer(m_command_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer_c, 1, &region);
+    m_command_buffer.end();
+
+    // buffer_b is first read in the next command buffer, after the transition was applied to the image
+    vkt::CommandBuffer command_buffer2(*m_device, m_command_pool);
+    command_buffer2.begin();
+    vk::CmdCopyImageToBuffer(command_buffer2, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer_d, 1, &region);
+    command_buffer2.Copy(buffer_b, buffer_e);
+    command_buffer2.end();
+
+    VkCommandBuffer cbs[2] = {m_command_buffer, command_buffer2};
+    VkSubmitInfo submit = vku::InitStructHelper();
+    submit.commandBufferCount = 2;
+    submit.pCommandBuffers = cbs;
+    vk::QueueSubmit(*m_default_queue, 1, &submit, VK_NULL_HANDLE);
+    m_default_queue->Wait();
+}
+
+TEST_F(PositiveSyncVal, GlobalBarrierPendingInExecutedCommands) {
+    TEST_DESCRIPTION("Secondary command buffer with pending global barriers is resolved into a primary that records its own");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    // Execution only barriers, they do not make the write available
+    VkMemoryBarrier execution_barrier = vku::InitStructHelper();
+    VkMemoryBarrier raw_barrier = vku::InitStructHelper();
+    raw_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    raw_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+    // The secondary records more global barriers than the primary, before and after the write
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    for (int i = 0; i < 2; ++i) {
+        vk::CmdPipelineBarrier(secondary, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &execution_barrier,
+                               0, nullptr, 0, nullptr);
+    }
+    secondary.Copy(buffer_b, buffer_a);
+    for (int i = 0; i < 2; ++i) {
+        vk::CmdPipelineBarrier(secondary, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &execution_barrier,
+                               0, nullptr, 0, nullptr);
+    }
+    secondary.end();
+
+    m_command_buffer.begin();
+    vk::CmdExecuteCommands(m_command_buffer, 1, &secondary.handle());
+    // The first global barrier of the primary must apply to the write resolved from the secondary
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &raw_barrier, 0,
+                           nullptr, 0, nullptr);
+    m_command_buffer.Copy(buffer_a, buffer_c);
+    m_command_buffer.end();
+}
+
+TEST_F(PositiveSyncVal, LayoutTransitionAfterPendingGlobalBarrier) {
+    TEST_DESCRIPTION("Layout transition chained with an earlier global barrier that the image was not used after");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    constexpr VkDeviceSize buffer_size = 64 * 64 * 4;
+    vkt::Buffer buffer(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Image image(*m_device, 64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM,
+                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {64, 64, 1};
+
+    // Makes the write available, with a dependency chain into the transfer stage
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+    memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.dstAccessMask = 0;
+
+    VkImageMemoryBarrier image_barrier = vku::InitStructHelper();
+    image_barrier.srcAccessMask = 0;
+    image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.image = image;
+    image_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+    m_command_buffer.begin();
+    vk::CmdCopyBufferToImage(m_command_buffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                           &memory_barrier, 0, nullptr, 0, nullptr);
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                           nullptr, 1, &image_barrier);
+    m_command_buffer.end();
+}
@@ -68,3 +68,31 @@ TEST_F(NegativeSyncValTimelineSemaphore, TwoQueuesWaitBeforeSignalStageMismatch)
     m_second_queue->Submit2WithTimelineSemaphore(vkt::no_cmd, vkt::signal, semaphore, 1);
     m_device->Wait();
 }
+
+TEST_F(NegativeSyncValTimelineSemaphore, TwoQueuesWaitDoesNotImportLargerSignal) {
+    TEST_DESCRIPTION("A wait for value 1 imports the signal of value 1, not the later signal of value 2 that would synchronize");
+    RETURN_IF_SKIP(InitTimelineSemaphore());
+
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Two queues are needed";
+    }
+    constexpr VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, usage);
+    vkt::Buffer buffer_b(*m_device, 256, usage);
+    vkt::Buffer buffer_c(*m_device, 256, usage);
+    m_command_buffer.begin();
+    m_command_buffer.Copy(buffer_a, buffer_b);
+    m_command_buffer.end();
+    m_second_command_buffer.begin();
+    m_second_command_buffer.Copy(buffer_b, buffer_c);
+    m_second_command_buffer.end();
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    // The copy is not in the scope of the signal of value 1, but it is in the scope of the signal of value 2
+    m_default_queue->Submit2WithTimelineSemaphore(m_command_buffer, vkt::signal, semaphore, 1, VK_PIPELINE_STAGE_2_CLEAR_BIT);
+    m_default_queue->Submit2WithTimelineSemaphore(vkt::no_cmd, vkt::signal, semaphore, 2);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    m_second_queue->Submit2WithTimelineSemaphore(m_second_command_buffer, vkt::wait, semaphore, 1, VK_PIPELINE_STAGE_2_COPY_BIT);
+    m_errorMonitor->VerifyFound();
+    m_device->Wait();
+}
@@ -152,3 +152,43 @@ TEST_F(PositiveSyncValTimelineSemaphore, TwoQueuesSignalThenWaitNonDefaultStage)
     m_second_queue->Submit2WithTimelineSemaphore(m_second_command_buffer, vkt::wait, semaphore, 1, VK_PIPELINE_STAGE_2_COPY_BIT);
     m_device->Wait();
 }
+
+TEST_F(PositiveSyncValTimelineSemaphore, TwoQueuesWaitForEachSignaledValue) {
+    TEST_DESCRIPTION("Each wait imports the signal of its own value, waits do not consume the signals");
+    RETURN_IF_SKIP(InitTimelineSemaphore());
+
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Two queues are needed";
+    }
+    constexpr VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, usage);
+    vkt::Buffer buffer_b(*m_device, 256, usage);
+    vkt::Buffer buffer_c(*m_device, 256, usage);
+    vkt::Buffer buffer_d(*m_device, 256, usage);
+    vkt::Buffer buffer_e(*m_device, 256, usage);
+
+    vkt::CommandBuffer write_b(*m_device, m_command_pool);
+    write_b.begin();
+    write_b.Copy(buffer_a, buffer_b);
+    write_b.end();
+    vkt::CommandBuffer write_c(*m_device, m_command_pool);
+    write_c.begin();
+    write_c.Copy(buffer_a, buffer_c);
+    write_c.end();
+
+    vkt::CommandBuffer read_b(*m_device, m_second_command_pool);
+    read_b.begin();
+    read_b.Copy(buffer_b, buffer_d);
+    read_b.end();
+    vkt::CommandBuffer read_c(*m_device, m_second_command_pool);
+    read_c.begin();
+    read_c.Copy(buffer_c, buffer_e);
+    read_c.end();
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    m_default_queue->Submit2WithTimelineSemaphore(write_b, vkt::signal, semaphore, 1);
+    m_default_queue->Submit2WithTimelineSemaphore(write_c, vkt::signal, semaphore, 2);
+    m_second_queue->Submit2WithTimelineSemaphore(read_b, vkt::wait, semaphore, 1);
+    m_second_queue->Submit2WithTimelineSemaphore(read_c, vkt::wait, semaphore, 2);
+    m_device->Wait();
+}
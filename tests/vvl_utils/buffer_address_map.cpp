@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <random>
+#include <vector>
+#include "state_tracker/buffer_address_map.h"
+
+// The map never dereferences the buffers, any distinct pointer value works
+static vvl::Buffer *FakeBuffer(uintptr_t id) { return reinterpret_cast<vvl::Buffer *>(id * 16); }
+
+static vvl::BufferAddressRangeMap::value_type MakeEntry(VkDeviceAddress begin, VkDeviceAddress end,
+                                                       std::initializer_list<vvl::Buffer *> buffers) {
+    return {vvl::BufferAddressRangeMap::key_type(begin, end), vvl::BufferAddressMapStore(buffers)};
+}
+
+// [0x1000, 0x2000) -> A
+// [0x2000, 0x3000) -> A, B
+// [0x5000, 0x6000) -> C
+static vvl::BufferAddressRangeMap MakeTestMap() {
+    vvl::BufferAddressRangeMap map;
+    map.insert(MakeEntry(0x1000, 0x2000, {FakeBuffer(1)}));
+    map.insert(MakeEntry(0x2000, 0x3000, {FakeBuffer(1), FakeBuffer(2)}));
+    map.insert(MakeEntry(0x5000, 0x6000, {FakeBuffer(3)}));
+    return map;
+}
+
+static std::vector<vvl::Buffer *> ToVector(const vvl::span<vvl::Buffer *const> &buffers) {
+    return std::vector<vvl::Buffer *>(buffers.begin(), buffers.end());
+}
+
+TEST(BufferAddressMap, SnapshotEmpty) {
+    vvl::BufferAddressSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Find(0).empty());
+    ASSERT_TRUE(snapshot.Find(0x1000).empty());
+
+    vvl::BufferAddressSnapshot empty_map_snapshot{vvl::BufferAddressRangeMap()};
+    ASSERT_TRUE(empty_map_snapshot.Ranges().empty());
+    ASSERT_TRUE(empty_map_snapshot.Find(0x1000).empty());
+}
+
+TEST(BufferAddressMap, SnapshotFind) {
+    const vvl::BufferAddressSnapshot snapshot(MakeTestMap());
+    ASSERT_EQ(snapshot.Ranges().size(), 3u);
+
+    const std::vector<vvl::Buffer *> a = {FakeBuffer(1)};
+    const std::vector<vvl::Buffer *> a_b = {FakeBuffer(1), FakeBuffer(2)};
+    const std::vector<vvl::Buffer *> c = {FakeBuffer(3)};
+
+    ASSERT_TRUE(snapshot.Find(0).empty());
+    ASSERT_TRUE(snapshot.Find(0xfff).empty());
+    ASSERT_EQ(ToVector(snapshot.Find(0x1000)), a);
+    ASSERT_EQ(ToVector(snapshot.Find(0x1fff)), a);
+    ASSERT_EQ(ToVector(snapshot.Find(0x2000)), a_b);
+    ASSERT_EQ(ToVector(snapshot.Find(0x2fff)), a_b);
+    // Gap between two ranges
+    ASSERT_TRUE(snapshot.Find(0x3000).empty());
+    ASSERT_TRUE(snapshot.Find(0x4fff).empty());
+    ASSERT_EQ(ToVector(snapshot.Find(0x5000)), c);
+    ASSERT_EQ(ToVector(snapshot.Find(0x5fff)), c);
+    ASSERT_TRUE(snapshot.Find(0x6000).empty());
+    ASSERT_TRUE(snapshot.Find(~VkDeviceAddress(0)).empty());
+}
+
+TEST(BufferAddressMap, FindBatch) {
+    vvl::BufferAddressMap map;
+    map.Update([](vvl::BufferAddressRangeMap &address_map) {
+        address_map = MakeTestMap();
+        return true;
+    });
+
+    // Unsorted, with duplicates, misses and addresses far apart so the search has to skip ranges
+    const std::vector<VkDeviceAddress> addresses = {0x5800, 0x1000, 0x2fff, 0x0, 0x5800, 0x3000, 0x1fff, 0x2000, 0x7000, 0x1000};
+    const vvl::BufferAddressBatchLookup batch = map.FindBatch(addresses);
+    ASSERT_EQ(batch.size(), addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        ASSERT_EQ(ToVector(batch[i]), ToVector(map.Find(addresses[i]))) << "address 0x" << std::hex << addresses[i];
+    }
+
+    const vvl::BufferAddressBatchLookup empty_batch = map.FindBatch({});
+    ASSERT_EQ(empty_batch.size(), 0u);
+}
+
+TEST(BufferAddressMap, FindBatchMatchesFind) {
+    // Many small ranges, some with gaps between them, queried with random addresses
+    vvl::BufferAddressRangeMap range_map;
+    std::mt19937_64 rng(0x5eed);
+    VkDeviceAddress address = 0x10000;
+    for (uintptr_t i = 1; i <= 256; ++i) {
+        const VkDeviceAddress size = 0x100 * (1 + rng() % 4);
+        range_map.insert(MakeEntry(address, address + size, {FakeBuffer(i)}));
+        address += size + ((rng() % 2) ? 0x100 : 0);
+    }
+    vvl::BufferAddressMap map;
+    map.Update([&range_map](vvl::BufferAddressRangeMap &address_map) {
+        address_map = range_map;
+        return true;
+    });
+
+    std::uniform_int_distribution<VkDeviceAddress> distribution(0xff00, address + 0x100);
+    for (int iteration = 0; iteration < 100; ++iteration) {
+        std::vector<VkDeviceAddress> addresses(1 + rng() % 64);
+        for (auto &query : addresses) {
+            query = distribution(rng);
+        }
+        const vvl::BufferAddressBatchLookup batch = map.FindBatch(addresses);
+        ASSERT_EQ(batch.size(), addresses.size());
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            ASSERT_EQ(ToVector(batch[i]), ToVector(map.Find(addresses[i]))) << "address 0x" << std::hex << addresses[i];
+        }
+    }
+}
+
+TEST(BufferAddressMap, UpdatePublishesSnapshot) {
+    vvl::BufferAddressMap map;
+    const uint32_t initial_version = map.Version();
+    ASSERT_TRUE(map.Find(0x1000).empty());
+
+    // No change, nothing is published
+    map.Update([](vvl::BufferAddressRangeMap &) { return false; });
+    ASSERT_EQ(map.Version(), initial_version);
+
+    map.Update([](vvl::BufferAddressRangeMap &address_map) {
+        address_map.insert(MakeEntry(0x1000, 0x2000, {FakeBuffer(1)}));
+        return true;
+    });
+    ASSERT_EQ(map.Version(), initial_version + 1);
+
+    const vvl::BufferAddressLookup lookup = map.Find(0x1800);
+    const std::vector<VkDeviceAddress> addresses = {0x1800};
+    const vvl::BufferAddressBatchLookup batch = map.FindBatch(addresses);
+    ASSERT_EQ(lookup.size(), 1u);
+    ASSERT_EQ(lookup[0], FakeBuffer(1));
+
+    // Results keep pointing to the snapshot they were found in after the map changes
+    map.Update([](vvl::BufferAddressRangeMap &address_map) {
+        address_map.clear();
+        return true;
+    });
+    ASSERT_EQ(map.Version(), initial_version + 2);
+    ASSERT_TRUE(map.Find(0x1800).empty());
+    ASSERT_EQ(lookup.size(), 1u);
+    ASSERT_EQ(lookup[0], FakeBuffer(1));
+    ASSERT_EQ(ToVector(batch[0]), std::vector<vvl::Buffer *>{FakeBuffer(1)});
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <string>
+
+TEST(CustomContainer, ChunkedVectorAppend) {
+    chunked_vector<int, 4> v;
+    ASSERT_TRUE(v.empty());
+    for (int i = 0; i < 10; ++i) {
+        v.emplace_back(i);
+    }
+    ASSERT_EQ(v.size(), 10u);
+    ASSERT_EQ(v.capacity(), 12u);
+    ASSERT_EQ(v.front(), 0);
+    ASSERT_EQ(v.back(), 9);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+
+    int expected = 0;
+    for (const int value : v) {
+        ASSERT_EQ(value, expected++);
+    }
+    ASSERT_EQ(std::distance(v.cbegin(), v.cend()), 10);
+}
+
+TEST(CustomContainer, ChunkedVectorStableAddresses) {
+    // Elements must not move when new chunks are added
+    chunked_vector<std::string, 2> v;
+    v.emplace_back("first element, long enough to not be a small string");
+    const std::string *first = &v[0];
+    for (int i = 0; i < 100; ++i) {
+        v.emplace_back(std::to_string(i));
+    }
+    ASSERT_EQ(first, &v[0]);
+    ASSERT_EQ(*first, "first element, long enough to not be a small string");
+    ASSERT_EQ(v[100], "99");
+}
+
+TEST(CustomContainer, ChunkedVectorCopyMove) {
+    chunked_vector<std::string, 4> v1;
+    for (int i = 0; i < 9; ++i) {
+        v1.push_back(std::to_string(i));
+    }
+
+    chunked_vector<std::string, 4> v2(v1);
+    ASSERT_EQ(v2.size(), v1.size());
+    for (size_t i = 0; i < v1.size(); ++i) {
+        ASSERT_EQ(v1[i], v2[i]);
+    }
+
+    v2.append(v1.begin(), v1.end());
+    ASSERT_EQ(v2.size(), 18u);
+    ASSERT_EQ(v2[17], "8");
+
+    chunked_vector<std::string, 4> v3(std::move(v2));
+    ASSERT_TRUE(v2.empty());
+    ASSERT_EQ(v3.size(), 18u);
+
+    v3 = v1;
+    ASSERT_EQ(v3.size(), 9u);
+    ASSERT_EQ(v3.back(), "8");
+
+    v3.clear();
+    ASSERT_TRUE(v3.empty());
+    ASSERT_EQ(v3.capacity(), 0u);
+}
+
+TEST(CustomContainer, ChunkedVectorReserve) {
+    chunked_vector<int, 8> v;
+    v.reserve(20);
+    ASSERT_EQ(v.capacity(), 24u);
+    ASSERT_TRUE(v.empty());
+    for (int i = 0; i < 24; ++i) {
+        v.push_back(i);
+    }
+    ASSERT_EQ(v.capacity(), 24u);
+    ASSERT_EQ(v[23], 23);
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <memory>
+#include <vector>
+#include "state_tracker/device_memory_state.h"
+#include "utils/cast_utils.h"
+
+using MemoryRange = vvl::BindableMemoryTracker::MemoryRange;
+using BoundMemoryRange = vvl::BindableMemoryTracker::BoundMemoryRange;
+
+static constexpr VkDeviceSize kPage = 0x1000;
+
+static std::shared_ptr<vvl::DeviceMemory> MakeMemory(uint64_t id) {
+    VkMemoryAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, 1024 * kPage, 0};
+    const VkMemoryType memory_type = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+    const VkMemoryHeap memory_heap = {1024 * kPage, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+    return std::make_shared<vvl::DeviceMemory>(CastFromUint64<VkDeviceMemory>(id), &allocate_info, 0, memory_type, memory_heap,
+                                               std::nullopt, 1);
+}
+
+// Stands for the buffer or image owning the tracker, the bound memories link back to it
+static std::shared_ptr<vvl::StateObject> MakeResource() {
+    return std::make_shared<vvl::StateObject>(CastFromUint64<VkBuffer>(0x100), kVulkanObjectTypeBuffer);
+}
+
+static VkMemoryRequirements MakeRequirements(VkDeviceSize size) { return {size, kPage, 1}; }
+
+static bool IsParent(const vvl::DeviceMemory &memory, const vvl::StateObject &resource) {
+    return memory.ObjectBindings().count(resource.Handle()) != 0;
+}
+
+TEST(SparseMemoryTracker, PageBindings) {
+    auto resource = MakeResource();
+    auto memory_a = MakeMemory(1);
+    auto memory_b = MakeMemory(2);
+    const VkMemoryRequirements requirements = MakeRequirements(8 * kPage);
+    vvl::BindableSparseMemoryTracker tracker(&requirements, false);
+    ASSERT_FALSE(tracker.HasFullRangeBound());
+
+    tracker.BindMemory(resource.get(), memory_a, 0, 0, 8 * kPage);
+    ASSERT_TRUE(tracker.HasFullRangeBound());
+    ASSERT_EQ(tracker.CountDeviceMemory(memory_a->VkHandle()), 8u);
+    ASSERT_TRUE(IsParent(*memory_a, *resource));
+
+    // Contiguous pages are reported as one memory range
+    BoundMemoryRange expected = {{memory_a->VkHandle(), {MemoryRange(kPage, 3 * kPage)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(kPage, 3 * kPage)), expected);
+
+    // Rebind page 2
+    tracker.BindMemory(resource.get(), memory_b, 16 * kPage, 2 * kPage, kPage);
+    ASSERT_TRUE(tracker.HasFullRangeBound());
+    ASSERT_EQ(tracker.CountDeviceMemory(memory_a->VkHandle()), 7u);
+    ASSERT_EQ(tracker.CountDeviceMemory(memory_b->VkHandle()), 1u);
+    ASSERT_TRUE(IsParent(*memory_b, *resource));
+
+    expected = {{memory_a->VkHandle(), {MemoryRange(kPage, 2 * kPage), MemoryRange(3 * kPage, 4 * kPage)}},
+                {memory_b->VkHandle(), {MemoryRange(16 * kPage, 17 * kPage)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(kPage, 4 * kPage)), expected);
+
+    // A range within pages is clamped to the range
+    expected = {{memory_a->VkHandle(), {MemoryRange(kPage + kPage / 2, 2 * kPage)}},
+                {memory_b->VkHandle(), {MemoryRange(16 * kPage, 16 * kPage + kPage / 2)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(kPage + kPage / 2, 2 * kPage + kPage / 2)), expected);
+
+    ASSERT_EQ(tracker.GetBoundMemoryStates().size(), 2u);
+}
+
+TEST(SparseMemoryTracker, PageUnbind) {
+    auto resource = MakeResource();
+    auto memory_a = MakeMemory(1);
+    auto memory_b = MakeMemory(2);
+    std::shared_ptr<vvl::DeviceMemory> no_memory;
+    const VkMemoryRequirements requirements = MakeRequirements(4 * kPage);
+    vvl::BindableSparseMemoryTracker tracker(&requirements, false);
+
+    tracker.BindMemory(resource.get(), memory_a, 0, 0, 3 * kPage);
+    tracker.BindMemory(resource.get(), memory_b, 0, 3 * kPage, kPage);
+    ASSERT_TRUE(tracker.HasFullRangeBound());
+
+    // Unbinding the only page of a memory removes the link to the resource
+    tracker.BindMemory(resource.get(), no_memory, 0, 3 * kPage, kPage);
+    ASSERT_FALSE(tracker.HasFullRangeBound());
+    ASSERT_EQ(tracker.CountDeviceMemory(memory_b->VkHandle()), 0u);
+    ASSERT_FALSE(IsParent(*memory_b, *resource));
+    ASSERT_TRUE(IsParent(*memory_a, *resource));
+    ASSERT_EQ(tracker.GetBoundMemoryStates().size(), 1u);
+    ASSERT_TRUE(tracker.GetBoundMemoryRange(MemoryRange(3 * kPage, 4 * kPage)).empty());
+
+    // Rebinding every page of a memory to another one also removes the link
+    tracker.BindMemory(resource.get(), memory_b, 0, 0, 4 * kPage);
+    ASSERT_TRUE(tracker.HasFullRangeBound());
+    ASSERT_EQ(tracker.CountDeviceMemory(memory_a->VkHandle()), 0u);
+    ASSERT_FALSE(IsParent(*memory_a, *resource));
+    ASSERT_TRUE(IsParent(*memory_b, *resource));
+}
+
+TEST(SparseMemoryTracker, PagePartialLastPage) {
+    auto resource = MakeResource();
+    auto memory = MakeMemory(1);
+    // The last page is only half used by the resource
+    const VkMemoryRequirements requirements = MakeRequirements(2 * kPage + kPage / 2);
+    vvl::BindableSparseMemoryTracker tracker(&requirements, false);
+
+    tracker.BindMemory(resource.get(), memory, 0, 0, 2 * kPage);
+    ASSERT_FALSE(tracker.HasFullRangeBound());
+    tracker.BindMemory(resource.get(), memory, 4 * kPage, 2 * kPage, kPage / 2);
+    ASSERT_TRUE(tracker.HasFullRangeBound());
+
+    const BoundMemoryRange expected = {
+        {memory->VkHandle(), {MemoryRange(kPage, 2 * kPage), MemoryRange(4 * kPage, 4 * kPage + kPage / 2)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(kPage, 4 * kPage)), expected);
+}
+
+TEST(SparseMemoryTracker, PageBlocks) {
+    auto resource = MakeResource();
+    auto memory = MakeMemory(1);
+    std::shared_ptr<vvl::DeviceMemory> no_memory;
+    // Spans several blocks of the page table
+    const VkMemoryRequirements requirements = MakeRequirements(2048 * kPage);
+    vvl::BindableSparseMemoryTracker tracker(&requirements, false);
+
+    tracker.BindMemory(resource.get(), memory, 0, 1000 * kPage, 100 * kPage);
+    ASSERT_EQ(tracker.CountDeviceMemory(memory->VkHandle()), 100u);
+    BoundMemoryRange expected = {{memory->VkHandle(), {MemoryRange(0, 100 * kPage)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(0, 2048 * kPage)), expected);
+
+    // Unbinding a range with empty blocks in it
+    tracker.BindMemory(resource.get(), no_memory, 0, 0, 1050 * kPage);
+    ASSERT_EQ(tracker.CountDeviceMemory(memory->VkHandle()), 50u);
+    expected = {{memory->VkHandle(), {MemoryRange(50 * kPage, 100 * kPage)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(0, 2048 * kPage)), expected);
+
+    tracker.BindMemory(resource.get(), no_memory, 0, 0, 2048 * kPage);
+    ASSERT_EQ(tracker.CountDeviceMemory(memory->VkHandle()), 0u);
+    ASSERT_FALSE(IsParent(*memory, *resource));
+    ASSERT_TRUE(tracker.GetBoundMemoryRange(MemoryRange(0, 2048 * kPage)).empty());
+}
+
+TEST(SparseMemoryTracker, UnalignedBindMovesToRangeMap) {
+    auto resource = MakeResource();
+    auto memory_a = MakeMemory(1);
+    auto memory_b = MakeMemory(2);
+    const VkMemoryRequirements requirements = MakeRequirements(4 * kPage);
+    vvl::BindableSparseMemoryTracker tracker(&requirements, false);
+
+    tracker.BindMemory(resource.get(), memory_a, 0, 0, 4 * kPage);
+    // Not page aligned, the pages are merged back into a single range of the range map
+    tracker.BindMemory(resource.get(), memory_b, 0, kPage / 2, kPage);
+    ASSERT_TRUE(tracker.HasFullRangeBound());
+    ASSERT_TRUE(IsParent(*memory_a, *resource));
+    ASSERT_TRUE(IsParent(*memory_b, *resource));
+
+    // The overlapping bind split the first binding in two, only the pieces left are still bound to memory A
+    const BoundMemoryRange expected = {
+        {memory_a->VkHandle(), {MemoryRange(0, kPage / 2), MemoryRange(kPage + kPage / 2, 4 * kPage)}},
+        {memory_b->VkHandle(), {MemoryRange(0, kPage)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(0, 4 * kPage)), expected);
+
+    const BoundMemoryRange expected_inner = {{memory_a->VkHandle(), {MemoryRange(2 * kPage, 3 * kPage)}}};
+    ASSERT_EQ(tracker.GetBoundMemoryRange(MemoryRange(2 * kPage, 3 * kPage)), expected_inner);
+}
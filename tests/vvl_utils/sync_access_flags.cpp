@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <bitset>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "sync/sync_access_flags.h"
+
+using TestFlags = SyncAccessBitset<192>;
+using ReferenceFlags = std::bitset<192>;
+
+static bool SameBits(const TestFlags &flags, const ReferenceFlags &reference) {
+    for (size_t i = 0; i < reference.size(); ++i) {
+        if (flags.test(i) != reference.test(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(SyncAccessFlags, Constexpr) {
+    constexpr TestFlags low = TestFlags(1) << 3;
+    constexpr TestFlags high = TestFlags(1) << 130;
+    constexpr TestFlags both = low | high;
+    static_assert(both.test(3) && both.test(130) && !both.test(4), "constexpr shift/or");
+    static_assert((both & ~low) == high, "constexpr and/not");
+    static_assert(both.intersects(high) && !low.intersects(high), "constexpr intersects");
+    static_assert(TestFlags::Bit(191) == (TestFlags(1) << 191), "Bit() matches shift");
+    static_assert(TestFlags().none() && !TestFlags().any(), "empty set");
+    ASSERT_EQ(both.count(), 2u);
+}
+
+TEST(SyncAccessFlags, Shift) {
+    for (size_t shift = 0; shift < 192; ++shift) {
+        const TestFlags flags = TestFlags(0x8000000000000081ULL) << shift;
+        const ReferenceFlags reference = ReferenceFlags(0x8000000000000081ULL) << shift;
+        ASSERT_TRUE(SameBits(flags, reference)) << "shift " << shift;
+    }
+    ASSERT_TRUE((TestFlags(1) << 192).none());
+}
+
+TEST(SyncAccessFlags, MatchesBitset) {
+    std::mt19937_64 rng(0x5eed);
+    for (int iteration = 0; iteration < 1000; ++iteration) {
+        TestFlags a, b;
+        ReferenceFlags ref_a, ref_b;
+        for (size_t i = 0; i < 192; ++i) {
+            if (rng() % 8 == 0) {
+                a.set(i);
+                ref_a.set(i);
+            }
+            if (rng() % 8 == 0) {
+                b.set(i);
+                ref_b.set(i);
+            }
+        }
+        ASSERT_TRUE(SameBits(a & b, ref_a & ref_b));
+        ASSERT_TRUE(SameBits(a | b, ref_a | ref_b));
+        ASSERT_TRUE(SameBits(a ^ b, ref_a ^ ref_b));
+        ASSERT_TRUE(SameBits(~a, ~ref_a));
+        ASSERT_EQ(a.count(), ref_a.count());
+        ASSERT_EQ(a.any(), ref_a.any());
+        ASSERT_EQ(a.intersects(b), (ref_a & ref_b).any());
+        ASSERT_EQ(a == b, ref_a == ref_b);
+
+        std::vector<size_t> set_bits;
+        a.ForEachSetBit([&set_bits](size_t index) { set_bits.emplace_back(index); });
+        ASSERT_EQ(set_bits.size(), ref_a.count());
+        for (size_t index : set_bits) {
+            ASSERT_TRUE(ref_a.test(index));
+        }
+        if (!set_bits.empty()) {
+            ASSERT_EQ(a.find_first(), set_bits.front());
+        } else {
+            ASSERT_EQ(a.find_first(), a.size());
+        }
+    }
+}
+
+// Times the operations syncval runs per access against the std::bitset<192> SyncStageAccessFlags used to be.
+// Not an assertion, timings depend on the machine: run with --gtest_also_run_disabled_tests and compare the output.
+template <typename Flags, typename IntersectFunc, typename ForEachFunc>
+static void BenchmarkFlags(const char *name, const std::vector<Flags> &flags, IntersectFunc &&intersects, ForEachFunc &&for_each) {
+    constexpr int kIterations = 200;
+    size_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < kIterations; ++iteration) {
+        Flags merged;
+        for (size_t i = 1; i < flags.size(); ++i) {
+            merged |= flags[i];
+            sink += intersects(flags[i - 1], flags[i]) ? 1 : 0;
+            sink += for_each(flags[i]);
+        }
+        sink += merged.count();
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    const double ns_per_op = static_cast<double>(elapsed.count()) / (static_cast<double>(kIterations) * (flags.size() - 1));
+    std::cout << name << ": " << ns_per_op << " ns per access (" << sink << ")\n";
+}
+
+TEST(SyncAccessFlags, DISABLED_BenchmarkAgainstBitset) {
+    // Sparse like real access masks, a few stage/access bits spread over the 192 bits
+    std::mt19937_64 rng(0x5eed);
+    std::vector<TestFlags> flags(4096);
+    std::vector<ReferenceFlags> reference(flags.size());
+    for (size_t i = 0; i < flags.size(); ++i) {
+        for (int bit = 0; bit < 4; ++bit) {
+            const size_t index = rng() % 192;
+            flags[i].set(index);
+            reference[i].set(index);
+        }
+    }
+
+    BenchmarkFlags(
+        "SyncAccessBitset<192>", flags, [](const TestFlags &a, const TestFlags &b) { return a.intersects(b); },
+        [](const TestFlags &a) {
+            size_t sum = 0;
+            a.ForEachSetBit([&sum](size_t index) { sum += index; });
+            return sum;
+        });
+    BenchmarkFlags(
+        "std::bitset<192>", reference, [](const ReferenceFlags &a, const ReferenceFlags &b) { return (a & b).any(); },
+        [](const ReferenceFlags &a) {
+            size_t sum = 0;
+            for (size_t index = 0; index < a.size(); ++index) {
+                if (a.test(index)) {
+                    sum += index;
+                }
+            }
+            return sum;
+        });
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include <atomic>
+#include <thread>
+#include "utils/thread_pool.h"
+
+TEST(ThreadPool, WaitNoThreads) {
+    vvl::ThreadPool pool(0);
+    vvl::ThreadPool::TaskGroup group;
+    uint32_t count = 0;
+    for (int i = 0; i < 16; ++i) {
+        pool.Submit("test", [&count]() { ++count; }, &group);
+    }
+    // Run by Submit itself
+    ASSERT_TRUE(group.Done());
+    pool.Wait(group);
+    ASSERT_EQ(count, 16u);
+}
+
+TEST(ThreadPool, WaitRunsAllGroupTasks) {
+    vvl::ThreadPool pool(3);
+    vvl::ThreadPool::TaskGroup group;
+    std::atomic<uint32_t> count{0};
+    for (int i = 0; i < 256; ++i) {
+        pool.Submit("test", [&count]() { count.fetch_add(1, std::memory_order_relaxed); }, &group);
+    }
+    pool.Wait(group);
+    ASSERT_TRUE(group.Done());
+    ASSERT_EQ(count.load(), 256u);
+}
+
+TEST(ThreadPool, WaitSkipsOtherGroups) {
+    vvl::ThreadPool pool(1);
+    std::atomic<bool> blocker_started{false};
+    std::atomic<bool> release_blocker{false};
+    std::atomic<bool> other_ran{false};
+    bool group_ran = false;
+
+    // Keep the only worker busy so the next tasks stay queued
+    pool.Submit("blocker", [&]() {
+        blocker_started = true;
+        while (!release_blocker) {
+            std::this_thread::yield();
+        }
+    });
+    while (!blocker_started) {
+        std::this_thread::yield();
+    }
+
+    vvl::ThreadPool::TaskGroup other_group;
+    pool.Submit("other", [&other_ran]() { other_ran = true; }, &other_group);
+    vvl::ThreadPool::TaskGroup group;
+    pool.Submit("group", [&group_ran]() { group_ran = true; }, &group);
+
+    // The group task can only run on this thread, the unrelated one stays queued for the worker
+    pool.Wait(group);
+    ASSERT_TRUE(group_ran);
+    ASSERT_FALSE(other_ran);
+
+    release_blocker = true;
+    pool.Wait(other_group);
+    ASSERT_TRUE(other_ran);
+}
+
+TEST(ThreadPool, StatsOnlyWhenCollected) {
+    vvl::ThreadPool pool(0);
+    pool.Submit("test", []() {});
+    ASSERT_TRUE(pool.GetTaskStats().empty());
+
+    vvl::ThreadPool stats_pool(0, true);
+    stats_pool.Submit("test", []() {});
+    stats_pool.Submit("test", []() {});
+    const auto stats = stats_pool.GetTaskStats();
+    ASSERT_EQ(stats.size(), 1u);
+    ASSERT_EQ(stats[0].second.count, 2u);
+}